@@ -0,0 +1,164 @@
+// fast_any check and benchmark against std::any: storing a small and a
+// large value, a cast to the stored type and a cast to another type. The
+// values must survive copies and moves, every constructed object must be
+// destroyed once, and a cast to the stored type must be no slower than
+// std::any's (best of five runs each, within 20% for timing noise); the
+// timings are reported.
+
+#include "../fast_any.h"
+#include "common.h"
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+
+namespace
+{
+    constexpr std::size_t iterations = 10000000;
+
+    using bench::expect;
+
+    inline void clobber(const void* p)
+    {
+        asm volatile("" : : "r"(p) : "memory");
+    }
+
+    template<typename F>
+    double ns_per_call(F f)
+    {
+        using clock = std::chrono::steady_clock;
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) { f(i); }
+        const std::chrono::duration<double, std::nano> elapsed =
+            clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+
+    // The best of five runs of each, taken in turns so that both see the
+    // same machine.
+    template<typename F, typename G>
+    std::pair<double, double> best_ns_per_call(F f, G g)
+    {
+        std::pair<double, double> best(ns_per_call(f), ns_per_call(g));
+        for (int run = 1; run < 5; ++run)
+        {
+            best.first = std::min(best.first, ns_per_call(f));
+            best.second = std::min(best.second, ns_per_call(g));
+        }
+        return best;
+    }
+
+    struct order { long id; double price; int qty; };
+    struct book { std::array<order, 8> levels; };
+
+    int alive = 0;
+
+    struct tracked
+    {
+        tracked() { ++alive; }
+        tracked(const tracked&) { ++alive; }
+        tracked(tracked&&) noexcept { ++alive; }
+        ~tracked() { --alive; }
+    };
+
+    template<typename T>
+    void report(const char* what, T fast, T standard)
+    {
+        std::printf("%-30s %6.2f ns fast_any %6.2f ns std::any\n",
+                    what, fast, standard);
+    }
+} // namespace
+
+int main()
+{
+    {
+        fast_any small = order{ 1, 2.5, 3 };
+        fast_any large = book{};
+        expect(small.type() == type_id<order>(), "small type");
+        expect(large.type().name() == type_name_v<book>, "large name");
+        expect(fast_any_cast<order&>(small).qty == 3, "small value");
+        expect(fast_any_cast<int>(&small) == nullptr, "bad cast");
+        fast_any copy = large;
+        fast_any moved = std::move(small);
+        expect(!small.has_value() && fast_any_cast<order>(&moved), "move");
+        expect(fast_any_cast<book>(&copy) != fast_any_cast<book>(&large),
+               "deep copy");
+        bool thrown = false;
+        try { fast_any_cast<int>(copy); }
+        catch (const std::bad_any_cast&) { thrown = true; }
+        expect(thrown, "bad_any_cast");
+        expect(fast_any().type() == type_id<void>(), "empty");
+
+        // Closures of one function share a name (and a hash) with GCC.
+        const int x = 7;
+        const std::string str = "seven";
+        auto by_value = [x] { return x; };
+        auto by_string = [str] { return static_cast<int>(str.size()); };
+        auto by_sum = [x] { return x + 1; };
+        fast_any closure = by_value;
+        expect(fast_any_cast<decltype(by_value)>(&closure) != nullptr,
+               "closure");
+        expect(fast_any_cast<decltype(by_string)>(&closure) == nullptr
+                   && fast_any_cast<decltype(by_sum)>(&closure) == nullptr,
+               "closures sharing a name");
+
+        fast_any a = tracked();
+        fast_any b = a;
+        b = std::move(a);
+        a.emplace<tracked>();
+        using heap_tracked = std::array<tracked, 8>;
+        fast_any c = heap_tracked();
+        fast_any d = c;
+        c = d;
+    }
+    expect(alive == 0, "every object destroyed once");
+
+    const order o{ 1, 2.5, 3 };
+    report("store small",
+        ns_per_call([&](std::size_t) { fast_any a = o; clobber(&a); }),
+        ns_per_call([&](std::size_t) { std::any a = o; clobber(&a); }));
+    report("store large",
+        ns_per_call([&](std::size_t) { fast_any a = book{}; clobber(&a); }),
+        ns_per_call([&](std::size_t) { std::any a = book{}; clobber(&a); }));
+
+    fast_any fast = o;
+    std::any standard = o;
+    const std::pair<double, double> cast = best_ns_per_call(
+        [&](std::size_t) {
+            clobber(&fast);
+            clobber(fast_any_cast<order>(&fast));
+        },
+        [&](std::size_t) {
+            clobber(&standard);
+            clobber(std::any_cast<order>(&standard));
+        });
+    report("cast", cast.first, cast.second);
+    expect(cast.first <= cast.second * 1.2, "cast no slower than std::any");
+    report("bad cast",
+        ns_per_call([&](std::size_t) {
+            clobber(&fast);
+            clobber(fast_any_cast<book>(&fast));
+        }),
+        ns_per_call([&](std::size_t) {
+            clobber(&standard);
+            clobber(std::any_cast<book>(&standard));
+        }));
+    report("bad cast, throwing",
+        ns_per_call([&](std::size_t i) {
+            if (i % 1000) { return; }
+            try { clobber(&fast_any_cast<book const&>(fast)); }
+            catch (const std::bad_any_cast&) {}
+        }) * 1000,
+        ns_per_call([&](std::size_t i) {
+            if (i % 1000) { return; }
+            try { clobber(&std::any_cast<book const&>(standard)); }
+            catch (const std::bad_any_cast&) {}
+        }) * 1000);
+
+    return bench::result();
+}
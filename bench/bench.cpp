@@ -0,0 +1,155 @@
+// Allocation and throughput check for rendering every shape of type that
+// main() prints. Global operator new is hooked to count allocations; any
+// allocation while rendering fails the run. So does a render slower than
+// its shape's own baseline, copying a run-time string of the same length
+// the same way, times TYPE_NAME_BENCH_SLACK (default 4) plus 2 ns for the
+// resolution of the clock.
+
+#include "../type_name.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::atomic<std::size_t> allocations(0);
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) { return p; }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    template <typename T>
+    struct t_s {};
+
+    struct s {};
+    enum struct e2 : int {};
+
+    constexpr std::size_t iterations = 1000000;
+
+    inline void clobber(const void* p)
+    {
+        asm volatile("" : : "r"(p) : "memory");
+    }
+
+    double slack()
+    {
+        const char* env = std::getenv("TYPE_NAME_BENCH_SLACK");
+        return env ? std::atof(env) : 4.0;
+    }
+
+    bool within(double ns, double baseline_ns)
+    {
+        return ns <= slack() * baseline_ns + 2.0;
+    }
+
+    template<typename F>
+    double ns_per_call(F f)
+    {
+        using clock = std::chrono::steady_clock;
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < iterations; ++i) { f(); }
+        const std::chrono::duration<double, std::nano> elapsed =
+            clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+
+    template<typename T>
+    bool bench(const char* shape)
+    {
+        char buffer[type_name_size_v<T>];
+        std::string str;
+        str.reserve(type_name_size_v<T>);
+        const std::string copy(type_name_size_v<T>, 'x');
+
+        const double copy_ns = ns_per_call([&] {
+            clobber(copy.data());
+            std::memcpy(buffer, copy.data(), sizeof(buffer));
+            clobber(buffer);
+        });
+        const double assign_ns = ns_per_call([&] {
+            clobber(copy.data());
+            str.clear();
+            str.append(copy);
+            clobber(str.data());
+        });
+
+        const std::size_t before = allocations;
+        const double render_ns = ns_per_call([&] {
+            render_to<T>(buffer, sizeof(buffer));
+            clobber(buffer);
+        });
+        const double append_ns = ns_per_call([&] {
+            str.clear();
+            append_to<T>(str);
+            clobber(str.data());
+        });
+        const std::size_t allocated = allocations - before;
+
+        const bool ok = allocated == 0
+            && within(render_ns, copy_ns) && within(append_ns, assign_ns);
+        std::printf("%-4s %-32s %5zu chars %8.2f ns render_to (%.2f)"
+                    " %8.2f ns append_to (%.2f) %zu allocs\n",
+                    ok ? "ok" : "FAIL", shape, type_name_size_v<T>,
+                    render_ns, copy_ns, append_ns, assign_ns, allocated);
+        return ok;
+    }
+}
+
+int main()
+{
+    bool ok = true;
+
+    ok &= bench<int>("fundamental");
+    ok &= bench<long double>("fundamental");
+    ok &= bench<int const volatile>("cv fundamental");
+#ifdef __GNUC__
+    ok &= bench<float __attribute__((vector_size(32)))>("vector");
+#endif // __GNUC__
+    ok &= bench<int[][4]>("array");
+    ok &= bench<int const* const>("pointer");
+    ok &= bench<int&&>("reference");
+    ok &= bench<int(int, char, const int *, char**)>("function");
+    ok &= bench<int(const char *, float, ...)>("variadic function");
+    ok &= bench<int(int) const volatile &&>("qualified function");
+    ok &= bench<int(* const volatile)(int)>("function pointer");
+    ok &= bench<int(&&)(int)>("function reference");
+    ok &= bench<int const s::* const volatile>("data member pointer");
+    ok &= bench<void (s::*)(int) const volatile &&>(
+        "cv member function pointer");
+    ok &= bench<void (s::* const volatile)(int, char, ...) const volatile &&>(
+        "cv variadic member pointer");
+#ifdef __cpp_noexcept_function_type
+    ok &= bench<void(* const)(int) noexcept>("noexcept function pointer");
+    ok &= bench<int (s::*)(int, ...) const && noexcept>(
+        "noexcept member function pointer");
+#endif // __cpp_noexcept_function_type
+    ok &= bench<s>("class");
+    ok &= bench<e2>("enum");
+    ok &= bench<t_s<s> >("template class");
+    ok &= bench<std::vector<std::vector<int> > >("nested vectors");
+    ok &= bench<std::map<std::string, int>::const_reverse_iterator>(
+        "map iterator");
+    ok &= bench<
+        const volatile std::map<std::string, int>&
+        (t_s<s>::* const volatile) (const volatile std::vector<int>&&,
+                                    char**, int[][5], const int * const,
+                                    int, ...)
+        const volatile &&
+    >("map member pointer signature");
+
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
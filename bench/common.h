@@ -0,0 +1,73 @@
+// Helpers shared by the checks in bench/: failed expectations are printed
+// and fail the run, and the registry checks build synthetic descriptors.
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include "../type_registry.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    inline bool ok = true;
+
+    inline void expect(bool condition, const char* what)
+    {
+        if (!condition)
+        {
+            std::printf("FAIL %s\n", what);
+            ok = false;
+        }
+    }
+
+    // Prints the verdict; the exit status for main().
+    inline int result()
+    {
+        std::printf("%s\n", ok ? "PASS" : "FAIL");
+        return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+#ifdef TYPE_NAME_REGISTRY
+    // `count` descriptors laid out like the registry section, for the
+    // names synthetic::payload<0>, synthetic::payload<1>, ... kept in one
+    // pool.
+    struct synthetic_types
+    {
+        explicit synthetic_types(std::size_t count)
+            : names(count), descriptors(count)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                names[i] = "synthetic::payload<" + std::to_string(i) + ">";
+                pool += names[i];
+            }
+            std::size_t offset = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                type_descriptor& d = descriptors[i];
+                d.name_offset =
+                    (pool.data() + offset) - reinterpret_cast<char*>(&d);
+                d.name_size = static_cast<std::uint32_t>(names[i].size());
+                d.hash = type_name_detail::fnv1a(names[i]);
+                offset += names[i].size();
+            }
+        }
+
+        type_registry_view view() const
+        {
+            return type_registry_view(
+                descriptors.data(), descriptors.data() + descriptors.size());
+        }
+
+        std::vector<std::string> names;
+        std::string pool;
+        std::vector<type_descriptor> descriptors;
+    };
+#endif // TYPE_NAME_REGISTRY
+} // namespace bench
+
+#endif // BENCH_COMMON_H
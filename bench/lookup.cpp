@@ -0,0 +1,120 @@
+// Lookup check and benchmark: type_table against std::unordered_map on
+// 100k synthetic descriptors, by hash and by name. Every key must be found,
+// with a dense id in hash order, and misses must come back empty; the
+// timings are reported.
+
+#include "common.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef TYPE_NAME_REGISTRY
+namespace
+{
+    constexpr std::size_t types = 100000;
+    constexpr std::size_t rounds = 20;
+
+    volatile std::uintptr_t sink;
+
+    template<typename F>
+    double ns_per_lookup(const std::vector<std::size_t>& order, F f)
+    {
+        using clock = std::chrono::steady_clock;
+        const auto start = clock::now();
+        for (std::size_t r = 0; r < rounds; ++r)
+        {
+            for (std::size_t i : order) { sink = f(i); }
+        }
+        const std::chrono::duration<double, std::nano> elapsed =
+            clock::now() - start;
+        return elapsed.count() / (rounds * order.size());
+    }
+} // namespace
+
+int main()
+{
+    const bench::synthetic_types synthetic(types);
+    const std::vector<std::string>& names = synthetic.names;
+    const std::vector<type_descriptor>& descriptors = synthetic.descriptors;
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    const type_table table(synthetic.view());
+    const std::chrono::duration<double, std::milli> build =
+        clock::now() - start;
+
+    std::unordered_map<std::string, const type_descriptor*> by_name;
+    std::unordered_map<std::uint64_t, const type_descriptor*> by_hash;
+    for (const type_descriptor& d : descriptors)
+    {
+        by_name.emplace(std::string(d.name()), &d);
+        by_hash.emplace(d.hash, &d);
+    }
+
+    bool ok = table.size() == types;
+    for (std::size_t i = 0; i < types; ++i)
+    {
+        ok &= table.find(descriptors[i].hash) == &descriptors[i];
+        ok &= table.find(names[i]) == &descriptors[i];
+    }
+    for (std::size_t id = 0; id < table.size(); ++id)
+    {
+        ok &= table.id(table[id].hash) == id;
+        ok &= id == 0 || table[id - 1].hash < table[id].hash;
+    }
+    ok &= table.find(type_name_detail::fnv1a("synthetic::missing")) == nullptr;
+    ok &= table.id(type_name_detail::fnv1a("synthetic::missing"))
+          == type_table::npos;
+    ok &= table.find("synthetic::missing") == nullptr;
+
+    const type_table registry(type_registry());
+    ok &= registry.find(type_name_v<std::vector<std::string> >) != nullptr;
+    ok &= registry.find(type_hash_v<int const*>) != nullptr;
+
+    std::vector<std::size_t> order(types);
+    for (std::size_t i = 0; i < types; ++i) { order[i] = i; }
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+    std::printf("%zu types, built in %.1f ms\n", types, build.count());
+    std::printf("%-40s %6.2f ns\n", "type_table by hash",
+        ns_per_lookup(order, [&](std::size_t i) {
+            return reinterpret_cast<std::uintptr_t>(
+                table.find(descriptors[i].hash));
+        }));
+    std::printf("%-40s %6.2f ns\n", "std::unordered_map by hash",
+        ns_per_lookup(order, [&](std::size_t i) {
+            return reinterpret_cast<std::uintptr_t>(
+                by_hash.find(descriptors[i].hash)->second);
+        }));
+    std::printf("%-40s %6.2f ns\n", "type_table by name",
+        ns_per_lookup(order, [&](std::size_t i) {
+            return reinterpret_cast<std::uintptr_t>(table.find(names[i]));
+        }));
+    std::printf("%-40s %6.2f ns\n", "std::unordered_map<std::string> by name",
+        ns_per_lookup(order, [&](std::size_t i) {
+            return reinterpret_cast<std::uintptr_t>(
+                by_name.find(names[i])->second);
+        }));
+
+    std::printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#elif defined(TYPE_NAME_ENABLE_REGISTRY)
+int main()
+{
+    std::printf("FAIL: TYPE_NAME_ENABLE_REGISTRY is defined, but this"
+                " build has no type registry\n");
+    return EXIT_FAILURE;
+}
+#else
+int main()
+{
+    std::printf("SKIP: no type registry without TYPE_NAME_ENABLE_REGISTRY\n");
+    return EXIT_SUCCESS;
+}
+#endif // TYPE_NAME_REGISTRY
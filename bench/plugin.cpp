@@ -0,0 +1,33 @@
+// A plugin for bench/plugins: it names types of its own and some that the
+// host names too, and inserts its registry into the host's catalog.
+
+#include "../type_registry.h"
+
+#include <vector>
+
+#ifdef TYPE_NAME_REGISTRY
+struct plugin_widget { int id; };
+
+namespace
+{
+    // Spelled like the host's cfg, a distinct type.
+    struct cfg { int level; };
+} // namespace
+
+extern "C" bool register_plugin_types(concurrent_type_registry& catalog)
+{
+    static_assert(type_name_v<std::vector<plugin_widget> >.size() != 0, "");
+    static_assert(type_name_v<int const*>.size() != 0, "");
+    return catalog.insert(type_registry());
+}
+
+extern "C" type_handle plugin_type_id()
+{
+    return type_id<int const*>();
+}
+
+extern "C" type_handle plugin_cfg_id()
+{
+    return type_id<cfg>();
+}
+#endif // TYPE_NAME_REGISTRY
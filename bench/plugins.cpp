@@ -0,0 +1,132 @@
+// Concurrent registry check: threads insert the same descriptors while
+// others look them up, then a plugin (argv[1]) is loaded with dlopen and
+// inserts its own section table. Types named on both sides must collapse
+// to the host's entry, and the plugin's own types must be found by name;
+// a same-named anonymous-namespace type on each side must not collapse.
+
+#include "common.h"
+
+#include <dlfcn.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef TYPE_NAME_REGISTRY
+namespace
+{
+    constexpr std::size_t types = 10000;
+    constexpr std::size_t writers = 4;
+    constexpr std::size_t readers = 4;
+
+    struct cfg { bool verbose; };  // so is the plugin's
+
+    using bench::expect;
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        std::printf("usage: %s plugin.so\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    concurrent_type_registry catalog;
+    static_assert(type_name_v<int const*>.size() != 0, "");
+    static_assert(type_name_v<cfg>.size() != 0, "");
+    expect(catalog.insert(type_registry()), "host types fit");
+    const std::size_t host_types = catalog.size();
+
+    const bench::synthetic_types synthetic(types);
+    const std::vector<std::string>& names = synthetic.names;
+    const std::vector<type_descriptor>& descriptors = synthetic.descriptors;
+
+    // Every writer inserts every descriptor; readers look them up meanwhile
+    // and must only ever see a complete entry or none.
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < writers; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (std::size_t i = 0; i < types; ++i)
+            {
+                const type_descriptor& d = descriptors[(i + t * 997) % types];
+                if (catalog.insert(d) != &d && !catalog.find(d.hash))
+                {
+                    expect(false, "insert");
+                }
+            }
+        });
+    }
+    for (std::size_t t = 0; t < readers; ++t)
+    {
+        threads.emplace_back([&] {
+            for (std::size_t i = 0; i < types; ++i)
+            {
+                const type_descriptor* d = catalog.find(descriptors[i].hash);
+                if (d && d->name() != names[i]) { expect(false, "find"); }
+            }
+        });
+    }
+    for (std::thread& thread : threads) { thread.join(); }
+    expect(catalog.size() == host_types + types, "duplicates collapse");
+    for (std::size_t i = 0; i < types; ++i)
+    {
+        expect(catalog.find(names[i]) == &descriptors[i], "first insert wins");
+    }
+
+    void* plugin = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+    expect(plugin != nullptr, "dlopen");
+    if (!plugin) { std::printf("%s\n", dlerror()); return EXIT_FAILURE; }
+    using register_types = bool (*)(concurrent_type_registry&);
+    const register_types register_plugin = reinterpret_cast<register_types>(
+        dlsym(plugin, "register_plugin_types"));
+    expect(register_plugin && register_plugin(catalog), "plugin types fit");
+
+    // The plugin has its own copy of the name: equal by hash, then by name.
+    using type_id_fn = type_handle (*)();
+    const type_id_fn plugin_type_id =
+        reinterpret_cast<type_id_fn>(dlsym(plugin, "plugin_type_id"));
+    expect(plugin_type_id && plugin_type_id() == type_id<int const*>()
+               && plugin_type_id() != type_id<int*>(), "type ids across");
+
+    const type_descriptor* shared = catalog.find(type_hash_v<int const*>);
+    const type_registry_view host = type_registry();
+    expect(shared >= host.begin() && shared < host.end(),
+           "shared type stays the host's");
+    const type_descriptor* widget = catalog.find(
+        "std::vector<plugin_widget, std::allocator<plugin_widget>>");
+    expect(widget && (widget < host.begin() || widget >= host.end()),
+           "plugin type from the plugin's section");
+
+    const type_id_fn plugin_cfg_id =
+        reinterpret_cast<type_id_fn>(dlsym(plugin, "plugin_cfg_id"));
+    const type_descriptor* host_cfg = catalog.find_stored(type_name_v<cfg>);
+    const type_descriptor* plugin_cfg =
+        plugin_cfg_id ? catalog.find_stored(plugin_cfg_id().name()) : nullptr;
+    expect(host_cfg && plugin_cfg && host_cfg != plugin_cfg
+               && plugin_cfg->size == sizeof(int),
+           "same name, an entry per type");
+    expect(plugin_cfg_id && plugin_cfg_id() != type_id<cfg>(),
+           "same name, distinct ids across");
+
+    std::printf("%zu host types, %zu after the plugin\n", host_types,
+                catalog.size() - types);
+    return bench::result();
+}
+#elif defined(TYPE_NAME_ENABLE_REGISTRY)
+int main()
+{
+    std::printf("FAIL: TYPE_NAME_ENABLE_REGISTRY is defined, but this"
+                " build has no type registry\n");
+    return EXIT_FAILURE;
+}
+#else
+int main()
+{
+    std::printf("SKIP: no type registry without TYPE_NAME_ENABLE_REGISTRY\n");
+    return EXIT_SUCCESS;
+}
+#endif // TYPE_NAME_REGISTRY
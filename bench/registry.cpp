@@ -0,0 +1,117 @@
+// Registry check: every type named in this program, in either translation
+// unit, is listed exactly once, with the name, hash and layout it was
+// compiled with, and gets a dense id. Built without <iostream>, so the
+// Makefile can check that the objects carry no .init_array (no static
+// constructors).
+
+#include "common.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef TYPE_NAME_REGISTRY
+namespace
+{
+    struct s { double d; int i; };
+    union u;
+    struct cfg { bool verbose; };  // so is registry_names.cpp's
+
+    using bench::expect;
+
+    template<typename T>
+    const type_descriptor* find()
+    {
+        const type_descriptor* found = nullptr;
+        for (const type_descriptor& d : type_registry())
+        {
+            if (d.hash == type_hash_v<T>)
+            {
+                expect(found == nullptr, "listed once");
+                found = &d;
+            }
+        }
+        return found;
+    }
+} // namespace
+
+void name_more_types();
+std::size_t other_cfg_id();
+
+int main()
+{
+    std::printf("%s\n", type_name_str<s>().data());
+    static_assert(type_name_v<std::vector<std::string> >.size() != 0, "");
+    static_assert(type_name_v<union u*>.size() != 0, "");
+    static_assert(!std::is_copy_constructible<type_descriptor>::value
+                      && !std::is_copy_assignable<type_descriptor>::value,
+                  "a copy would lose its name");
+    name_more_types();
+
+    const type_registry_view registry = type_registry();
+    for (const type_descriptor& d : registry)
+    {
+        expect(type_name_detail::fnv1a(d.name()) == d.hash, "hash of the name");
+    }
+
+    const type_descriptor* d = find<s>();
+    expect(d && d->name() == type_name_v<s>, "struct name");
+    expect(d && d->size == sizeof(s) && d->align == alignof(s), "struct size");
+    expect(d && d->has(type_descriptor::class_type)
+             && d->has(type_descriptor::trivially_copyable), "struct traits");
+
+    d = find<int const*>();  // also named in the other translation unit
+    expect(d && d->has(type_descriptor::pointer)
+             && !d->has(type_descriptor::const_qualified), "pointer traits");
+
+    d = find<union u>();
+    expect(d && d->size == 0 && !d->has(type_descriptor::complete),
+           "incomplete union");
+
+    d = find<int(int)>();
+    expect(d && d->has(type_descriptor::function) && d->size == 0,
+           "function traits");
+
+    expect(find<std::vector<std::string> >() != nullptr, "compile time only");
+
+    const std::size_t id = dense_type_id<s>();
+    expect(id < registry.size()
+             && registered_types()[id].hash == type_hash_v<s>, "dense id");
+    expect(dense_type_id<union u>() != id, "distinct dense ids");
+
+    std::size_t cfgs = 0;
+    for (const type_descriptor& c : registry)
+    {
+        cfgs += c.name() == type_name_v<cfg>;
+    }
+    expect(cfgs == 2, "same name, one descriptor per type");
+    expect(registered_types().size() == registry.size(),
+           "same name, one table entry per type");
+    const std::size_t cfg_id = dense_type_id<cfg>();
+    expect(cfg_id != type_table::npos && other_cfg_id() != type_table::npos
+             && cfg_id != other_cfg_id(), "same name, distinct dense ids");
+    expect(cfg_id != type_table::npos
+             && registered_types()[cfg_id].size == sizeof(cfg)
+             && registered_types()[other_cfg_id()].size == sizeof(int),
+           "same name, each id its own type");
+
+    std::printf("%zu types, %zu bytes of descriptors\n",
+                registry.size(), registry.size() * sizeof(type_descriptor));
+    return bench::result();
+}
+#elif defined(TYPE_NAME_ENABLE_REGISTRY)
+int main()
+{
+    std::printf("FAIL: TYPE_NAME_ENABLE_REGISTRY is defined, but this"
+                " build has no type registry\n");
+    return EXIT_FAILURE;
+}
+#else
+int main()
+{
+    std::printf("SKIP: no type registry without TYPE_NAME_ENABLE_REGISTRY\n");
+    return EXIT_SUCCESS;
+}
+#endif // TYPE_NAME_REGISTRY
@@ -0,0 +1,24 @@
+// The second translation unit of the registry check.
+
+#include "../type_registry.h"
+
+#include <cstdio>
+
+namespace
+{
+    // Spelled like the cfg of the first translation unit, a distinct type.
+    struct cfg { int level; };
+} // namespace
+
+void name_more_types()
+{
+    std::printf("%s\n", type_name_str<int const*>().data());
+    std::printf("%s\n", type_name_str<int(int)>().data());
+}
+
+#ifdef TYPE_NAME_REGISTRY
+std::size_t other_cfg_id()
+{
+    return dense_type_id<cfg>();
+}
+#endif // TYPE_NAME_REGISTRY
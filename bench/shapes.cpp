@@ -0,0 +1,43 @@
+// Compile-time check, only compiled (see `make compile-time`): the hash of
+// every function shape, plain and C-variadic, with each of the twelve
+// cv/ref qualifier sets, as a function and as a member function pointer,
+// for SHAPES_COUNT distinct parameter types.
+
+#include "../type_name.h"
+
+#include <cstdint>
+#include <utility>
+
+#ifndef SHAPES_COUNT
+#define SHAPES_COUNT 20
+#endif // SHAPES_COUNT
+
+template<int I>
+struct shape_tag {};
+
+#define SHAPES(cvr)                                                         \
+    type_hash_v<void(shape_tag<I>) cvr>,                                    \
+    type_hash_v<int(shape_tag<I>, ...) cvr>,                                \
+    type_hash_v<void (shape_tag<I>::*)(int) cvr>,                           \
+    type_hash_v<int (shape_tag<I>::*)(int, ...) cvr>
+
+template<int I>
+constexpr std::uint64_t shapes[] = {
+    SHAPES(), SHAPES(const), SHAPES(volatile), SHAPES(const volatile),
+    SHAPES(&), SHAPES(const &), SHAPES(volatile &), SHAPES(const volatile &),
+    SHAPES(&&), SHAPES(const &&), SHAPES(volatile &&),
+    SHAPES(const volatile &&),
+    type_hash_v<void(*)(shape_tag<I>)>, type_hash_v<void(&)(shape_tag<I>)>,
+};
+
+template<int... Is>
+constexpr std::uint64_t mix(std::integer_sequence<int, Is...>)
+{
+    std::uint64_t hash = 0;
+    for (std::uint64_t h : { shapes<Is>[0]... }) { hash ^= h; }
+    return hash;
+}
+
+static_assert(mix(std::make_integer_sequence<int, SHAPES_COUNT>()) != 0, "");
+
+int main() {}
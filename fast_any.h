@@ -0,0 +1,233 @@
+#ifndef FAST_ANY_H
+#define FAST_ANY_H
+
+#include "type_name.h"
+
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+#include <any>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//************************
+//* FAST ANY
+//************************
+
+// A std::any that knows its type by type_id<T>() instead of typeid: a cast
+// to the stored type is one pointer compare, as with std::any, any other
+// cast compares type ids and never a type_info, and the stored type's name
+// is a compile-time string. Values of up to Capacity bytes that move
+// without throwing are kept in place; larger ones are allocated. Failed
+// casts behave like std::any_cast.
+
+namespace type_name_detail
+{
+    struct any_ops
+    {
+        type_handle id;
+        void (*destroy)(void* storage);
+        void (*copy)(void* to, const void* from);
+        void (*move)(void* to, void* from);  // and destroys `from`
+    };
+
+    template<typename T, bool Local>
+    struct any_storage;
+
+    template<typename T>
+    struct any_storage<T, true>
+    {
+        static T* get(void* storage) { return static_cast<T*>(storage); }
+
+        template<typename... Args>
+        static void create(void* storage, Args&&... args)
+        {
+            ::new (storage) T(std::forward<Args>(args)...);
+        }
+
+        static void destroy(void* storage) { get(storage)->~T(); }
+
+        static void copy(void* to, const void* from)
+        {
+            create(to, *get(const_cast<void*>(from)));
+        }
+
+        static void move(void* to, void* from)
+        {
+            create(to, std::move(*get(from)));
+            destroy(from);
+        }
+    };
+
+    template<typename T>
+    struct any_storage<T, false>
+    {
+        static T* get(void* storage) { return *static_cast<T**>(storage); }
+
+        template<typename... Args>
+        static void create(void* storage, Args&&... args)
+        {
+            *static_cast<T**>(storage) = new T(std::forward<Args>(args)...);
+        }
+
+        static void destroy(void* storage) { delete get(storage); }
+
+        static void copy(void* to, const void* from)
+        {
+            create(to, *get(const_cast<void*>(from)));
+        }
+
+        static void move(void* to, void* from)
+        {
+            *static_cast<T**>(to) = get(from);
+        }
+    };
+
+    template<typename T, bool Local>
+    inline constexpr any_ops any_ops_v = {
+        type_id<T>(),
+        &any_storage<T, Local>::destroy,
+        &any_storage<T, Local>::copy,
+        &any_storage<T, Local>::move,
+    };
+} // namespace type_name_detail
+
+template<std::size_t Capacity>
+class basic_fast_any
+{
+    template<typename T>
+    static constexpr bool local = sizeof(T) <= Capacity
+        && alignof(T) <= alignof(std::max_align_t)
+        && std::is_nothrow_move_constructible<T>::value;
+
+    template<typename T>
+    using storage = type_name_detail::any_storage<T, local<T> >;
+
+public:
+    static_assert(Capacity >= sizeof(void*), "room for a heap pointer");
+
+    basic_fast_any() = default;
+
+    basic_fast_any(const basic_fast_any& other) : ops_(other.ops_)
+    {
+        if (ops_) { ops_->copy(buffer_, other.buffer_); }
+    }
+
+    basic_fast_any(basic_fast_any&& other) noexcept : ops_(other.ops_)
+    {
+        if (ops_) { ops_->move(buffer_, other.buffer_); }
+        other.ops_ = nullptr;
+    }
+
+    template<typename V, typename T = std::decay_t<V>,
+             typename = std::enable_if_t<
+                 !std::is_same<T, basic_fast_any>::value> >
+    basic_fast_any(V&& value)
+    {
+        emplace<T>(std::forward<V>(value));
+    }
+
+    ~basic_fast_any() { reset(); }
+
+    basic_fast_any& operator=(const basic_fast_any& other)
+    {
+        return *this = basic_fast_any(other);
+    }
+
+    basic_fast_any& operator=(basic_fast_any&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            ops_ = other.ops_;
+            if (ops_) { ops_->move(buffer_, other.buffer_); }
+            other.ops_ = nullptr;
+        }
+        return *this;
+    }
+
+    template<typename T, typename... Args>
+    T& emplace(Args&&... args)
+    {
+        reset();
+        storage<T>::create(buffer_, std::forward<Args>(args)...);
+        ops_ = &type_name_detail::any_ops_v<T, local<T> >;
+        return *storage<T>::get(buffer_);
+    }
+
+    void reset()
+    {
+        if (ops_) { ops_->destroy(buffer_); }
+        ops_ = nullptr;
+    }
+
+    bool has_value() const { return ops_ != nullptr; }
+
+    // The stored type, or void when empty.
+    type_handle type() const { return ops_ ? ops_->id : type_id<void>(); }
+
+    // The ops pointer settles the common case inline; anything else is
+    // left to other_get_if, out of line.
+    template<typename T>
+    T* get_if()
+    {
+        return ops_ == &type_name_detail::any_ops_v<T, local<T> >
+            ? storage<T>::get(buffer_) : other_get_if<T>();
+    }
+
+    template<typename T>
+    const T* get_if() const
+    {
+        return const_cast<basic_fast_any*>(this)->template get_if<T>();
+    }
+
+private:
+    // A value stored by another shared object, whose ops are its own, is
+    // still a T if its type id is T's. Types whose names are not unique
+    // (closures...) only match within one binary; see type_handle. Not
+    // inlined, so a cast that succeeds costs one pointer compare and no
+    // stack frame.
+    template<typename T>
+    __attribute__((noinline)) T* other_get_if()
+    {
+        return ops_ && ops_->id == type_id<T>()
+            ? storage<T>::get(buffer_) : nullptr;
+    }
+
+    const type_name_detail::any_ops* ops_ = nullptr;
+    alignas(std::max_align_t) unsigned char buffer_[Capacity];
+};
+
+// Room for three pointers, e.g. a small callback and its context.
+using fast_any = basic_fast_any<3 * sizeof(void*)>;
+
+template<typename T, std::size_t Capacity>
+T* fast_any_cast(basic_fast_any<Capacity>* any) noexcept
+{
+    return any ? any->template get_if<T>() : nullptr;
+}
+
+template<typename T, std::size_t Capacity>
+const T* fast_any_cast(const basic_fast_any<Capacity>* any) noexcept
+{
+    return any ? any->template get_if<T>() : nullptr;
+}
+
+template<typename T, std::size_t Capacity>
+T fast_any_cast(const basic_fast_any<Capacity>& any)
+{
+    using U = std::remove_cv_t<std::remove_reference_t<T> >;
+    if (const U* value = any.template get_if<U>()) { return *value; }
+    throw std::bad_any_cast();
+}
+
+template<typename T, std::size_t Capacity>
+T fast_any_cast(basic_fast_any<Capacity>& any)
+{
+    using U = std::remove_cv_t<std::remove_reference_t<T> >;
+    if (U* value = any.template get_if<U>()) { return *value; }
+    throw std::bad_any_cast();
+}
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+
+#endif // FAST_ANY_H
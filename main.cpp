@@ -1,524 +1,28 @@
+#include "type_name.h"
+
+#include <array>
+#include <bitset>
+#include <cassert>
+#include <chrono>
 #include <iostream>
-#include <ostream>
-#include <type_traits>
-#include <vector>
-#include <string>
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
-//************************
-//* FUNDAMENTIAL TYPES
-//************************
-
-template<typename... Ts>
-struct type_name
-{
-    friend std::ostream& operator<<(std::ostream& os, type_name)
-    {
-        return os;
-    }
-};
-
-#define FUNDAMENTIAL_TYPE_NAME(type)                                        \
-template<>                                                                  \
-struct type_name<type>                                                      \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << #type;                                                        \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNDAMENTIAL_TYPE_NAME(void);
-#if __cplusplus >= 201402L // C++14
-FUNDAMENTIAL_TYPE_NAME(std::nullptr_t);
-#endif //__cplusplus >= 201402L
-FUNDAMENTIAL_TYPE_NAME(bool);
-FUNDAMENTIAL_TYPE_NAME(char);
-FUNDAMENTIAL_TYPE_NAME(signed char);
-FUNDAMENTIAL_TYPE_NAME(unsigned char);
-FUNDAMENTIAL_TYPE_NAME(short int);
-FUNDAMENTIAL_TYPE_NAME(int);
-FUNDAMENTIAL_TYPE_NAME(long int);
-FUNDAMENTIAL_TYPE_NAME(long long int);
-FUNDAMENTIAL_TYPE_NAME(unsigned short int);
-FUNDAMENTIAL_TYPE_NAME(unsigned int);
-FUNDAMENTIAL_TYPE_NAME(unsigned long int);
-FUNDAMENTIAL_TYPE_NAME(unsigned long long int);
-FUNDAMENTIAL_TYPE_NAME(float);
-FUNDAMENTIAL_TYPE_NAME(double);
-FUNDAMENTIAL_TYPE_NAME(long double);
-
-//************************
-//* COMPOUND TYPES
-//************************
-
-#define COMPOUND_TYPE_NAME_DELIMITED(delimiter, type_modifier)              \
-template<typename T>                                                        \
-struct type_name<T type_modifier>                                           \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<T>();                                               \
-        os << delimiter << #type_modifier;                                  \
-        return os;                                                          \
-    }                                                                       \
-}
-
-#define COMPOUND_TYPE_NAME(type_modifier)                                   \
-    COMPOUND_TYPE_NAME_DELIMITED("", type_modifier)
-
-// ARRAYS
-COMPOUND_TYPE_NAME([]);
-
-template<typename T, std::size_t N>
-struct type_name<T[N]> : type_name<T[]> {};
-
-// POINTER, REF and CV
-COMPOUND_TYPE_NAME(*);
-COMPOUND_TYPE_NAME(&);
-COMPOUND_TYPE_NAME(&&);
-COMPOUND_TYPE_NAME_DELIMITED(" ", const);
-COMPOUND_TYPE_NAME_DELIMITED(" ", volatile);
-COMPOUND_TYPE_NAME_DELIMITED(" ", const volatile);
-
-// ARGUMENTS
-template<typename Arg, typename... Args>
-struct type_name<Arg, Args...>
-{
-    friend std::ostream& operator<<(std::ostream& os, type_name)
-    {
-        os << type_name<Arg>() << ", " << type_name<Args...>();
-        return os;
-    }
-};
-
-// FUNCTION
-template<typename R, typename... Args>
-struct type_name<R(Args...)>
-{
-    friend std::ostream& operator<<(std::ostream& os, type_name)
-    {
-        os << type_name<R>();
-        os << "(" << type_name<Args...>() << ")";
-        return os;
-    }
-};
-
-#define FUNCTION_CVR_TYPE_NAME(cvr)                                         \
-template<typename R, typename... Args>                                      \
-struct type_name<R(Args...) cvr>                                            \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R(Args...)>();                                      \
-        os << " " << #cvr;                                                  \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_CVR_TYPE_NAME(const);
-FUNCTION_CVR_TYPE_NAME(volatile);
-FUNCTION_CVR_TYPE_NAME(const volatile);
-FUNCTION_CVR_TYPE_NAME(&);
-FUNCTION_CVR_TYPE_NAME(const &);
-FUNCTION_CVR_TYPE_NAME(volatile &);
-FUNCTION_CVR_TYPE_NAME(const volatile &);
-FUNCTION_CVR_TYPE_NAME(&&);
-FUNCTION_CVR_TYPE_NAME(const &&);
-FUNCTION_CVR_TYPE_NAME(volatile &&);
-FUNCTION_CVR_TYPE_NAME(const volatile &&);
-
-// POINTER TO FUNCTION, REF TO FUNCTION
-#define FUNCTION_PR_TYPE_NAME(pr)                                           \
-template<typename R, typename... Args>                                      \
-struct type_name<R(pr)(Args...)>                                            \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(" << #pr << ")";                                            \
-        os << "(" << type_name<Args...>() << ")";                           \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_PR_TYPE_NAME(*);    // function pointer
-FUNCTION_PR_TYPE_NAME(* const);
-FUNCTION_PR_TYPE_NAME(* volatile);
-FUNCTION_PR_TYPE_NAME(* const volatile);
-FUNCTION_PR_TYPE_NAME(&);    // function lvalue reference
-FUNCTION_PR_TYPE_NAME(&&);    // function rvalue reference
-
-// function with mix of plain and variardic arguments
-
-#define FUNCTION_MIX_CVR_TYPE_NAME(cvr)                                     \
-template<typename R, typename... Args>                                      \
-struct type_name<R(Args..., ...) cvr>                                       \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(" << type_name<Args...>() <<  ", ...)";                     \
-        if (!std::string(#cvr).empty()) { os << " "; }                      \
-        os << #cvr;                                                         \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_MIX_CVR_TYPE_NAME();
-FUNCTION_MIX_CVR_TYPE_NAME(const);
-FUNCTION_MIX_CVR_TYPE_NAME(volatile);
-FUNCTION_MIX_CVR_TYPE_NAME(const volatile);
-FUNCTION_MIX_CVR_TYPE_NAME(&);
-FUNCTION_MIX_CVR_TYPE_NAME(const &);
-FUNCTION_MIX_CVR_TYPE_NAME(volatile &);
-FUNCTION_MIX_CVR_TYPE_NAME(const volatile &);
-FUNCTION_MIX_CVR_TYPE_NAME(&&);
-FUNCTION_MIX_CVR_TYPE_NAME(const &&);
-FUNCTION_MIX_CVR_TYPE_NAME(volatile &&);
-FUNCTION_MIX_CVR_TYPE_NAME(const volatile &&);
-
-#define FUNCTION_PR_MIX_TYPE_NAME(pr)                                       \
-template<typename R, typename... Args>                                      \
-struct type_name<R(pr)(Args..., ...)>                                       \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(" << #pr << ")";                                            \
-        os << "(" << type_name<Args...>() <<  ", ...)";                     \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_PR_MIX_TYPE_NAME(*);    // function pointer
-FUNCTION_PR_MIX_TYPE_NAME(* const);
-FUNCTION_PR_MIX_TYPE_NAME(* volatile);
-FUNCTION_PR_MIX_TYPE_NAME(* const volatile);
-FUNCTION_PR_MIX_TYPE_NAME(&);    // function lvalue reference
-FUNCTION_PR_MIX_TYPE_NAME(&&);    // function rvalue reference
-
-// function with variardic arguments
-#define FUNCTION_VAR_TYPE_NAME(cvr)                                         \
-template<typename R>                                                        \
-struct type_name<R(...) cvr>                                                \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(...)";                                                      \
-        if (!std::string(#cvr).empty()) { os << " "; }                      \
-        os << #cvr;                                                         \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_VAR_TYPE_NAME();
-FUNCTION_VAR_TYPE_NAME(const);
-FUNCTION_VAR_TYPE_NAME(volatile);
-FUNCTION_VAR_TYPE_NAME(const volatile);
-FUNCTION_VAR_TYPE_NAME(&);
-FUNCTION_VAR_TYPE_NAME(const &);
-FUNCTION_VAR_TYPE_NAME(volatile &);
-FUNCTION_VAR_TYPE_NAME(const volatile &);
-FUNCTION_VAR_TYPE_NAME(&&);
-FUNCTION_VAR_TYPE_NAME(const &&);
-FUNCTION_VAR_TYPE_NAME(volatile &&);
-FUNCTION_VAR_TYPE_NAME(const volatile &&);
-
-// function with variardic arguments
-#define FUNCTION_PR_VAR_TYPE_NAME(pr)                                       \
-template<typename R>                                                        \
-struct type_name<R(pr)(...)>                                                \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(" << #pr << ")";                                            \
-        os << "(...)";                                                      \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_PR_VAR_TYPE_NAME(*);    // function pointer
-FUNCTION_PR_VAR_TYPE_NAME(* const);
-FUNCTION_PR_VAR_TYPE_NAME(* volatile);
-FUNCTION_PR_VAR_TYPE_NAME(* const volatile);
-FUNCTION_PR_VAR_TYPE_NAME(&);    // function lvalue reference
-FUNCTION_PR_VAR_TYPE_NAME(&&);    // function rvalue reference
-
-// function pointer to member
-#define FUNCTION_CLASS_PTR_TYPE_NAME(p, cvr)                                \
-template<typename R, typename C, typename... Args>                          \
-struct type_name<R(C:: p)(Args...) cvr>                                     \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(" << type_name<C>() << "::" << #p << ")";                   \
-        os << "(" << type_name<Args...>() << ")";                           \
-        if (!std::string(#cvr).empty()) { os << " "; }                      \
-        os << #cvr;                                                         \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_CLASS_PTR_TYPE_NAME(*,);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, const);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, const volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, &);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, const &);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, const volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, const &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, volatile &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(*, const volatile &&);
-
-FUNCTION_CLASS_PTR_TYPE_NAME(* const,);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, const);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, const volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, const &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, const volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, const &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, volatile &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const, const volatile &&);
-
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile,);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, const);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, const volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, const &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, const volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, const &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, volatile &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* volatile, const volatile &&);
-
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile,);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, const);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, const volatile);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, const &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, const volatile &);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, const &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, volatile &&);
-FUNCTION_CLASS_PTR_TYPE_NAME(* const volatile, const volatile &&);
-
-// function pointer to member, mixed args
-#define FUNCTION_CLASS_PTR_MIX_TYPE_NAME(p, cvr)                            \
-template<typename R, typename C, typename... Args>                          \
-struct type_name<R(C:: p)(Args..., ...) cvr>                                \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(" << type_name<C>() << "::" << #p << ")";                   \
-        os << "(" << type_name<Args...>()  <<  ", ...)";                    \
-        if (!std::string(#cvr).empty()) { os << " "; }                      \
-        os << #cvr;                                                         \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*,);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, const);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, const volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, const &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, const volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, const &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, volatile &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(*, const volatile &&);
-
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const,);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, const);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, const volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, const &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, const volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, const &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, volatile &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const, const volatile &&);
-
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile,);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, const);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, const volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, const &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, const volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, const &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, volatile &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* volatile, const volatile &&);
-
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile,);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, const);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, const volatile);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, const &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, const volatile &);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, const &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, volatile &&);
-FUNCTION_CLASS_PTR_MIX_TYPE_NAME(* const volatile, const volatile &&);
-
-// function pointer to member, variadic args
-#define FUNCTION_CLASS_PTR_VAR_TYPE_NAME(p, cvr)                            \
-template<typename R, typename C>                                            \
-struct type_name<R(C:: p)(...) cvr>                                         \
-{                                                                           \
-    friend std::ostream& operator<<(std::ostream& os, type_name)            \
-    {                                                                       \
-        os << type_name<R>();                                               \
-        os << "(" << type_name<C>() << "::" << #p << ")";                   \
-        os << "(...)";                                                      \
-        if (!std::string(#cvr).empty()) { os << " "; }                      \
-        os << #cvr;                                                         \
-        return os;                                                          \
-    }                                                                       \
-}
-
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*,);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, const);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, const volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, const &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, const volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, const &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, volatile &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(*, const volatile &&);
-
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const,);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, const);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, const volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, const &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, const volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, const &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, volatile &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const, const volatile &&);
-
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile,);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, const);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, const volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, const &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, const volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, const &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, volatile &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* volatile, const volatile &&);
-
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile,);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, const);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, const volatile);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, const &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, const volatile &);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, const &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, volatile &&);
-FUNCTION_CLASS_PTR_VAR_TYPE_NAME(* const volatile, const volatile &&);
-
-
-/* SFINAE attempt -- not working
-#if __cplusplus < 201402L // C++11 or before
-namespace std
-{
-    template< bool B, class T = void >
-    using enable_if_t = typename enable_if<B, T>::type;
-}
-#endif //__cplusplus < 201402L
-template <typename F>
-using enable_if_function = std::enable_if_t<std::is_function<F>::value>;
-template <typename F, typename = enable_if_function<F> >
-struct type_name<F const> : type_name<F> {};
-*/
-
-// template class
-template <template <typename...> class C, typename... Args>
-struct type_name< C<Args...> >
-{
-    friend std::ostream& operator<<(std::ostream& os, type_name)
-    {
-        os << "template";
-        os << "<" << type_name<Args...>() << ">";
-
-        return os;
-    }
-};
-
-// class
-template <typename C>
-struct type_name<C>
-{
-    friend std::ostream& operator<<(std::ostream& os, type_name)
-    {
-        if (std::is_union<C>::value) {
-            os << "union";
-        }
-        else if (std::is_enum<C>::value)
-        {
-            os << "enum";
-        }
-        else
-        {
-            os << "class";
-        }
-
-        return os;
-    }
-};
-
-// pointer to member
-template <typename T, typename C>
-struct type_name<T C::*>
-{
-    friend std::ostream& operator<<(std::ostream& os, type_name)
-    {
-        os << type_name<T>() << " class::*";
-
-        return os;
-    }
-};
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif // __SSE2__
 
+enum class flush_policy { none, flush };
 
-template<typename T>
-void print()
+// Prints one line per type with a single write; flushing is up to the caller.
+template<typename... Ts>
+void print(flush_policy policy = flush_policy::none)
 {
-    std::cout << type_name<T>() << std::endl;
+    const type_name_view lines = type_name_lines_str<Ts...>();
+    std::cout.write(lines.data(), lines.size());
+    if (policy == flush_policy::flush) { std::cout.flush(); }
 }
 
 int f(int) { return 0; };
@@ -545,6 +49,49 @@ struct fn {
     int operator()(int) { return 0; };
 };
 
+struct overloaded_fn {
+    int operator()(int) const { return 0; };
+    int operator()(char) const { return 0; };
+};
+
+#if __cplusplus >= 201402L // C++14
+template <std::size_t I, typename T>
+struct nth_arg { using type = T; };
+
+template <typename T, std::size_t... Is>
+std::size_t pack_name_size(std::index_sequence<Is...>)
+{
+    return type_name_str<typename nth_arg<Is, T>::type...>().size();
+}
+#endif //__cplusplus >= 201402L
+
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+static_assert(type_name_v<int const* const> == "int const* const", "");
+static_assert(type_name_size_v<int(*)(int)> == sizeof("int(*)(int)") - 1, "");
+static_assert(type_name_v<e2> == "e2", "");
+static_assert(type_name_v<fn> == "fn", "");
+static_assert(type_signature_v<fn> == "fn : int(int)", "");
+static_assert(type_name_v<int fn::*> == "int fn::*", "");
+static_assert(type_name_v<t_s<int> > == "t_s<int>", "");
+static_assert(type_name_lines_v<int, e2> == "int\ne2\n", "");
+static_assert(type_names_v<int, e2>[1] == "e2", "");
+static_assert(type_names_v<int, e2>[0].data()
+              == type_name_lines_v<int, e2>.data(), "");
+static_assert(type_name_v<int[16][4]> == "int[16][4]", "");
+static_assert(type_hash_v<int> == 0x2b9fff192bd4c83eull, "");
+static_assert(type_hash_v<int*> != type_hash_v<int const*>, "");
+static_assert(type_name_v<int t_s<int>::*> == "int t_s<int>::*", "");
+static_assert(type_hash_v<int t_s<int>::*> != type_hash_v<int t_s<char>::*>,
+              "");
+static_assert(type_id<int>() == type_id<int>(), "");
+static_assert(type_id<int>() != type_id<int const>(), "");
+static_assert(type_name_v<void(*(*)(int))(char)> == "void(*(*)(int))(char)",
+              "");
+static_assert(type_name_v<void(*)() noexcept> == "void(*)() noexcept", "");
+static_assert(type_name_v<std::chrono::nanoseconds>
+              == "std::chrono::duration<long int, ns>", "");
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+
 int main()
 {
     print<int>();
@@ -553,6 +100,12 @@ int main()
     print<const int volatile>();
     print<int[]>();
     print<int[][4]>();
+    print<int[16][4]>();
+    print<const int[3]>();
+    print<int(*)[4]>();
+    print<int(&)[2][3]>();
+    print<int*[8]>();
+    print<int(*[8])(int)>();
     print<int&>();
     print<decltype(std::move(5))>();
     print<int*>();
@@ -575,7 +128,14 @@ int main()
     print<int(int) const &&>();
     print<int(int) volatile &&>();
     print<int(int) const volatile &&>();
+#ifdef __cpp_noexcept_function_type
     print<int(int) const noexcept>();
+    print<int(...) noexcept>();
+    print<void(*)(int) noexcept>();
+    print<void(* const)(int, ...) noexcept>();
+    print<void(&)() noexcept>();
+    print<void(&&)() noexcept>();
+#endif // __cpp_noexcept_function_type
     print<int(...) const>();
     print<int(void)>();
     print<void(void)>();
@@ -587,26 +147,68 @@ int main()
     print<struct c>();
     struct s{};
     print<int const s::* const volatile>();
+    print<int t_s<s>::*>();
+    print<int(t_s<s>::*)[4]>();
     print<void (s::*)(int) const volatile &&>();
     print<void (s::*)(...) const volatile &&>();
     print<void (s::* const volatile)(int, char, ...) const volatile &&>();
+#ifdef __cpp_noexcept_function_type
+    print<void (s::*)(int) noexcept>();
+    print<void (s::*)(int) const & noexcept>();
+    print<int (s::* const)(...) volatile && noexcept>();
+#endif // __cpp_noexcept_function_type
     print<int(*)(int)>();
     print<int(&)(int)>();
     print<int(&&)(int)>();
     print<int(* const volatile)(int)>();
     print<int(*)(...)>();
     print<int(*)(int, ...)>();
+    print<void(*(*)(int))(char)>();
+    print<void(*(int))(char)>();
+    print<int(&(*)(int))[4]>();
+    print<int(*(*)[3])(int)>();
+    print<int*(*)(int)>();
     print<ptrdiff_t>();
+    print<wchar_t, char16_t, char32_t>();
+#ifdef __cpp_char8_t
+    print<char8_t>();
+#endif // __cpp_char8_t
+#ifdef __SIZEOF_INT128__
+    print<__int128, unsigned __int128 const*>();
+#endif // __SIZEOF_INT128__
+#ifdef __FLT16_MANT_DIG__
+    print<_Float16>();
+#endif // __FLT16_MANT_DIG__
+#ifdef __GNUC__
+    print<float __attribute__((vector_size(32)))>();
+    print<unsigned char __attribute__((vector_size(64)))>();
+#endif // __GNUC__
+#ifdef __SSE2__
+    print<__m128, __m128d, __m128i>();
+#endif // __SSE2__
     print<std::vector<int> >();
     print<std::vector<std::vector<int> > >();
     print<std::vector<std::string> >();
     print< t_s<int> >();
     print< t_s<s> >();
-    print<e>();
-    print<e2>();
-    print<e3>();
-    print<byte>();
-    print<smallenum>();
+    print<std::array<int, 4> >();
+    print<std::bitset<64> >();
+    print<std::integral_constant<smallenum, b> >();
+    print<std::integral_constant<e3, e3{}> >();
+    print<std::integral_constant<char, 'x'> >();
+#ifdef __cpp_char8_t
+    print<std::integral_constant<char8_t, u8'x'> >();
+#endif // __cpp_char8_t
+    print<std::integral_constant<long, -42> >();
+    print<std::ratio<1, 1000> >();
+    print<std::chrono::milliseconds>();
+    print<std::chrono::duration<double, std::ratio<1, 60> > >();
+    print<std::chrono::duration<float, std::micro> >();
+#if __cplusplus >= 201402L // C++14
+    print<std::integer_sequence<int, 1, -2, 3> >();
+    print<std::index_sequence<> >();
+#endif //__cplusplus >= 201402L
+    print<fn, e, e2, e3, byte, smallenum>(flush_policy::flush);
     print<
         const volatile std::map<std::string, int>& 
         (t_s<s>::* const volatile) (const volatile std::vector<int>&&,
@@ -622,6 +224,75 @@ int main()
     print<decltype(lambda)>();
 
     print< std::map<int, decltype(lambda)> >();
+    std::cout << type_signature_str<fn>() << "\n"
+              << type_signature_str<decltype(lambda)>() << "\n"
+              << type_signature_str<overloaded_fn>() << "\n";
+#if __cplusplus >= 201402L // C++14
+    auto generic = [](auto x) { return x; };
+    std::cout << type_signature_str<decltype(generic)>() << "\n";
+#endif //__cplusplus >= 201402L
+#ifdef __cpp_noexcept_function_type
+    auto quiet = [](int) noexcept {};
+    std::cout << type_signature_str<decltype(quiet)>() << "\n";
+#endif // __cpp_noexcept_function_type
+
+    auto first = TYPE_NAME_LOCATED([]() { return 1; });
+    auto second = TYPE_NAME_LOCATED([]() { return 2; });
+    print<decltype(first), decltype(second)>();
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+    static_assert(type_hash_v<decltype(first)> != type_hash_v<decltype(second)>,
+                  "");
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+    assert(first() + second() == 3);
+
+    char buffer[64] = {};
+    render_to<fn, e2>(buffer, sizeof(buffer) - 1);
+    std::cout << buffer << std::endl;
+
+    std::string line = "name: ";
+    line.reserve(line.size() + type_name_str<int(*)(int)>().size());
+    std::cout << append_to<int(*)(int)>(line) << std::endl;
+
+    // Same name, distinct types: told apart by their tags.
+    auto one = [] { return 1; };
+    auto two = [] { return 2; };
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+    static_assert(type_id<decltype(one)>() == type_id<decltype(one)>(), "");
+    static_assert(type_id<decltype(one)>() != type_id<decltype(two)>(), "");
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+    std::cout << std::boolalpha << (type_id<fn>() == type_id<fn>()) << " "
+              << (type_id<fn>() == type_id<e2>()) << " "
+              << (type_id<decltype(one)>() == type_id<decltype(two)>())
+              << std::endl;
+
+    // Local classes are spelled after their function only, as closures are:
+    // both of these are main()::local, and only their ids tell them apart.
+    type_handle first_local = type_id<void>();
+    type_handle second_local = type_id<void>();
+    {
+        struct local {};
+        first_local = type_id<local>();
+    }
+    {
+        struct local {};
+        second_local = type_id<local>();
+    }
+    assert(first_local.name() == "main()::local");
+    assert(first_local.name() == second_local.name());
+    assert(first_local != second_local);
+
+#ifdef TYPE_NAME_HAS_IOVEC
+    auto names = to_iovec<int, fn, e2>();
+    std::cout << names.size() << " iovecs, "
+              << names[0].iov_len + names[1].iov_len + names[2].iov_len
+              << " bytes" << std::endl;
+#endif // TYPE_NAME_HAS_IOVEC
+
+#if __cplusplus >= 201402L // C++14
+    // 5000 arguments: "int, int, ..., int"
+    std::cout << pack_name_size<int>(std::make_index_sequence<5000>())
+              << std::endl;
+#endif //__cplusplus >= 201402L
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,1587 @@
+#ifndef TYPE_NAME_H
+#define TYPE_NAME_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <ratio>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 201703L // C++17
+#include <string_view>
+// Names are rendered by the compiler and exposed as type_name_v<T>.
+#define TYPE_NAME_CONSTEXPR_NAMES 1
+#define TYPE_NAME_CONSTEXPR constexpr
+#else
+// Names are rendered at run time, once per type (see
+// type_name_detail::name_string).
+#define TYPE_NAME_CONSTEXPR
+#endif //__cplusplus >= 201703L
+
+#if defined(__has_include)
+#if __has_include(<sys/uio.h>)
+#include <sys/uio.h>
+#define TYPE_NAME_HAS_IOVEC 1
+#endif
+#endif // defined(__has_include)
+
+// The type registry (see REGISTRY) is opt-in: it keeps a descriptor, and
+// the name, of every type rendered, including those only named inside
+// another name. Define TYPE_NAME_ENABLE_REGISTRY in every translation unit
+// to turn it on. It is written with GNU assembler directives into an ELF
+// section, by GCC from C++17 on x86-64; elsewhere there is no registry, and
+// the registry checks in bench/ fail rather than pass unchecked.
+#if defined(TYPE_NAME_ENABLE_REGISTRY) && defined(TYPE_NAME_CONSTEXPR_NAMES) \
+    && defined(__ELF__) && defined(__x86_64__) && defined(__GNUC__)          \
+    && !defined(__clang__)
+#define TYPE_NAME_REGISTRY 1
+#define TYPE_NAME_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define TYPE_NAME_HIDDEN
+#endif
+
+template<typename... Ts>
+struct type_name;
+
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+using type_name_view = std::string_view;
+#else
+// The subset of std::string_view the library needs before C++17.
+class type_name_view
+{
+public:
+    type_name_view(const char* data, std::size_t size)
+        : data_(data), size_(size) {}
+    type_name_view(const char* str) : data_(str), size_(std::strlen(str)) {}
+
+    const char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    std::size_t find(type_name_view str) const
+    {
+        for (std::size_t i = 0; i + str.size_ <= size_; ++i)
+        {
+            if (std::memcmp(data_ + i, str.data_, str.size_) == 0) { return i; }
+        }
+        return static_cast<std::size_t>(-1);
+    }
+
+    type_name_view substr(std::size_t pos, std::size_t count) const
+    {
+        return type_name_view(data_ + pos, count);
+    }
+
+    friend bool operator==(type_name_view lhs, type_name_view rhs)
+    {
+        return lhs.size_ == rhs.size_
+            && std::memcmp(lhs.data_, rhs.data_, lhs.size_) == 0;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, type_name_view str)
+    {
+        return os.write(str.data_, str.size_);
+    }
+
+private:
+    const char* data_;
+    std::size_t size_;
+};
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+
+//************************
+//* RENDERING
+//************************
+
+// Every type_name<Ts...> describes its name with a `write(Sink&)` member,
+// and every name is rendered once per type: a nested type_name<...> is
+// appended from its own, already rendered, string.
+//
+// From C++17 the sinks are literal types and the whole name is rendered
+// while compiling: one pass measures it, a second copies it into a
+// fixed_string of exactly that size. Older compilers cannot evaluate that,
+// so there each name is rendered on first use into a function-local static.
+
+namespace type_name_detail
+{
+    template<typename Name>
+    TYPE_NAME_CONSTEXPR type_name_view name_string();
+
+    // Every fragment of a name is appended through one of these, which are
+    // not overloaded and not operators: rendering a name costs no overload
+    // resolution, and no argument-dependent lookup through the namespaces of
+    // the template arguments. Literals go through append_literal, so their
+    // length is known without a scan. Sinks provide `put(data, size)`.
+    template<typename Derived>
+    struct sink
+    {
+        TYPE_NAME_CONSTEXPR Derived& append(type_name_view str)
+        {
+            self().put(str.data(), str.size());
+            return self();
+        }
+
+        template<std::size_t N>
+        TYPE_NAME_CONSTEXPR Derived& append_literal(const char (&str)[N])
+        {
+            self().put(str, N - 1);
+            return self();
+        }
+
+        // Decimal digits, e.g. for array bounds.
+        TYPE_NAME_CONSTEXPR Derived& append_unsigned(std::uintmax_t value)
+        {
+            char digits[20] = {};
+            std::size_t n = 0;
+            do
+            {
+                const char digit = static_cast<char>('0' + value % 10);
+                digits[sizeof(digits) - ++n] = digit;
+                value /= 10;
+            } while (value != 0);
+            self().put(digits + sizeof(digits) - n, n);
+            return self();
+        }
+
+        TYPE_NAME_CONSTEXPR Derived& append_signed(std::intmax_t value)
+        {
+            if (value >= 0) { return append_unsigned(std::uintmax_t(value)); }
+            self().put("-", 1);
+            return append_unsigned(0 - static_cast<std::uintmax_t>(value));
+        }
+
+    private:
+        TYPE_NAME_CONSTEXPR Derived& self()
+        {
+            return static_cast<Derived&>(*this);
+        }
+    };
+
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+    template<std::size_t N>
+    struct fixed_string
+    {
+        char data[N + 1] = {};
+
+        constexpr std::size_t size() const { return N; }
+    };
+
+    // Both passes use this one sink, so each write() is instantiated once:
+    // without a buffer it only counts.
+    struct render_sink : sink<render_sink>
+    {
+        char* data = nullptr;
+        std::size_t size = 0;
+
+        constexpr void put(const char* str, std::size_t n)
+        {
+            if (data)
+            {
+                for (std::size_t i = 0; i < n; ++i) { data[size + i] = str[i]; }
+            }
+            size += n;
+        }
+    };
+
+    template<typename Name>
+    constexpr std::size_t measure()
+    {
+        render_sink s;
+        Name::write(s);
+        return s.size;
+    }
+
+    template<std::size_t N, typename Name>
+    constexpr fixed_string<N> render()
+    {
+        fixed_string<N> str;
+        render_sink s;
+        s.data = str.data;
+        Name::write(s);
+        return str;
+    }
+
+    // Storage for anything with a `write(Sink&)` member. Hidden when there
+    // is a registry: every shared object keeps its own copy of the names it
+    // lists, so it can refer to them without relocations.
+    template<typename Name>
+    struct TYPE_NAME_HIDDEN rendered_string
+    {
+        static constexpr std::size_t size = measure<Name>();
+        static constexpr fixed_string<size> value = render<size, Name>();
+    };
+
+    template<typename... Ts>
+    struct TYPE_NAME_HIDDEN rendered : rendered_string<type_name<Ts...> > {};
+
+#ifdef TYPE_NAME_REGISTRY
+    // Lists single types in the registry; see REGISTRY.
+    template<typename Name>
+    struct registration
+    {
+        static constexpr void enlist()
+        {
+        }
+    };
+#endif // TYPE_NAME_REGISTRY
+
+    template<typename Name>
+    constexpr type_name_view name_string()
+    {
+#ifdef TYPE_NAME_REGISTRY
+        (void)&registration<Name>::enlist;
+#endif // TYPE_NAME_REGISTRY
+        return type_name_view(rendered_string<Name>::value.data,
+                              rendered_string<Name>::size);
+    }
+#else
+    struct string_sink : sink<string_sink>
+    {
+        std::string str;
+
+        void put(const char* data, std::size_t n) { str.append(data, n); }
+    };
+
+    // Initialization of the local static is thread-safe, and every later
+    // call is a guard check and a load. The string is never freed, so the
+    // name stays valid during static destruction.
+    template<typename Name>
+    type_name_view name_string()
+    {
+        static const std::string* const name = [] {
+            string_sink s;
+            Name::write(s);
+            return new std::string(s.str);
+        }();
+        return type_name_view(name->data(), name->size());
+    }
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+
+    // 64-bit FNV-1a: byte-wise, so the value only depends on the spelling
+    // of the name and not on the platform or the translation unit.
+    TYPE_NAME_CONSTEXPR std::uint64_t fnv1a(type_name_view str)
+    {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (const char* p = str.data(), *end = p + str.size(); p != end; ++p)
+        {
+            hash ^= static_cast<unsigned char>(*p);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+} // namespace type_name_detail
+
+// The name of Ts... as a view of static storage.
+template<typename... Ts>
+TYPE_NAME_CONSTEXPR type_name_view type_name_str()
+{
+    return type_name_detail::name_string<type_name<Ts...> >();
+}
+
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+template<typename... Ts>
+inline constexpr std::size_t type_name_size_v =
+    type_name_detail::rendered<Ts...>::size;
+
+template<typename... Ts>
+inline constexpr type_name_view type_name_v =
+    type_name_detail::name_string<type_name<Ts...> >();
+
+template<typename... Ts>
+inline constexpr std::uint64_t type_hash_v =
+    type_name_detail::fnv1a(type_name_v<Ts...>);
+
+template<typename... Ts>
+constexpr std::uint64_t type_hash()
+{
+    return type_hash_v<Ts...>;
+}
+#else
+template<typename... Ts>
+std::uint64_t type_hash()
+{
+    static const std::uint64_t hash =
+        type_name_detail::fnv1a(type_name_str<Ts...>());
+    return hash;
+}
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+
+template<typename... Ts>
+std::ostream& operator<<(std::ostream& os, type_name<Ts...>)
+{
+    const type_name_view name = type_name_str<Ts...>();
+    return os.write(name.data(), name.size());
+}
+
+//************************
+//* SINKS
+//************************
+
+// Ways to get a name out without going through std::ostream. Each one is a
+// single copy (or none) of the static string and never allocates: the
+// caller sizes its buffer or string with type_name_str<Ts...>().size().
+
+// Copies up to `size` characters of the name into `buffer`, without a
+// terminator, and returns the full length of the name.
+template<typename... Ts>
+std::size_t render_to(char* buffer, std::size_t size)
+{
+    const type_name_view name = type_name_str<Ts...>();
+    std::memcpy(buffer, name.data(), size < name.size() ? size : name.size());
+    return name.size();
+}
+
+// Appends the name to `str`; allocates only if `str` lacks the capacity.
+template<typename... Ts>
+std::string& append_to(std::string& str)
+{
+    const type_name_view name = type_name_str<Ts...>();
+    return str.append(name.data(), name.size());
+}
+
+#ifdef TYPE_NAME_HAS_IOVEC
+// One iovec per type, pointing at the static names, for a gathered
+// writev(2). Unlike the functions above, every Ts is a separate entry.
+template<typename... Ts>
+std::array<iovec, sizeof...(Ts)> to_iovec()
+{
+    return {{ iovec{ const_cast<char*>(type_name_str<Ts>().data()),
+                     type_name_str<Ts>().size() }... }};
+}
+#endif // TYPE_NAME_HAS_IOVEC
+
+//************************
+//* LOCATED CLOSURES
+//************************
+
+// GCC spells every closure type after its enclosing function and call
+// signature only, so two lambdas in one function can share a name (and a
+// hash). Wrapping a lambda with TYPE_NAME_LOCATED adds where it was
+// written: `main()::<lambda()> at main.cpp:113`. The wrapper derives from
+// the closure, so it is called exactly like it.
+//
+// Local classes have the same limit and no such wrapper: two `struct s` in
+// different blocks of one function are both `main()::s`. type_id still
+// tells them apart (see TYPE IDS).
+//
+//     auto on_fill = TYPE_NAME_LOCATED([](int qty) { ... });
+
+template <typename F, typename Here>
+struct type_name_located : F
+{
+    static_assert(std::is_class<F>::value, "only closures can be located");
+
+    explicit TYPE_NAME_CONSTEXPR type_name_located(F f) : F(std::move(f)) {}
+
+    using F::operator();
+};
+
+namespace type_name_detail
+{
+    template<typename F, typename Here>
+    TYPE_NAME_CONSTEXPR type_name_located<F, Here> locate(F f, Here)
+    {
+        return type_name_located<F, Here>(std::move(f));
+    }
+} // namespace type_name_detail
+
+#define TYPE_NAME_LOCATED(...)                                              \
+    ::type_name_detail::locate(__VA_ARGS__, [] {                            \
+        struct here                                                         \
+        {                                                                   \
+            static TYPE_NAME_CONSTEXPR type_name_view file()                \
+            {                                                               \
+                return __FILE__;                                            \
+            }                                                               \
+                                                                            \
+            static TYPE_NAME_CONSTEXPR std::uintmax_t line()                \
+            {                                                               \
+                return __LINE__;                                            \
+            }                                                               \
+        };                                                                  \
+        return here();                                                      \
+    }())
+
+template <typename F, typename Here>
+struct type_name< type_name_located<F, Here> >
+{
+    template<typename Sink>
+    static TYPE_NAME_CONSTEXPR void write(Sink& s)
+    {
+        s.append(type_name_str<F>()).append_literal(" at ");
+        s.append(Here::file());
+        s.append_literal(":").append_unsigned(Here::line());
+    }
+};
+
+//************************
+//* BATCHES
+//************************
+
+namespace type_name_detail
+{
+    template<typename... Ts>
+    struct name_lines
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)
+        {
+            bool lines[] = {
+                true,
+                (s.append(type_name_str<Ts>()).append_literal("\n"), true)...
+            };
+            (void)lines;
+        }
+    };
+} // namespace type_name_detail
+
+// The names of Ts, each followed by a newline, as a single string: a whole
+// inventory goes out in one write.
+template<typename... Ts>
+TYPE_NAME_CONSTEXPR type_name_view type_name_lines_str()
+{
+    using lines = type_name_detail::name_lines<Ts...>;
+    return type_name_detail::name_string<lines>();
+}
+
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+template<typename... Ts>
+inline constexpr type_name_view type_name_lines_v =
+    type_name_lines_str<Ts...>();
+
+namespace type_name_detail
+{
+    // Views of the separate names inside the name_lines blob, so a batch
+    // and its individual names share one copy of the characters.
+    template<typename... Ts>
+    constexpr std::array<type_name_view, sizeof...(Ts)> pooled_names()
+    {
+        using pool = rendered_string<name_lines<Ts...> >;
+        const std::size_t sizes[] = { 0, rendered<Ts>::size... };
+
+        std::array<type_name_view, sizeof...(Ts)> names{};
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            names[i] = type_name_view(pool::value.data + offset, sizes[i + 1]);
+            offset += sizes[i + 1] + 1;
+        }
+        return names;
+    }
+} // namespace type_name_detail
+
+// The names of Ts as separate views into the type_name_lines_v<Ts...> blob.
+template<typename... Ts>
+inline constexpr std::array<type_name_view, sizeof...(Ts)> type_names_v =
+    type_name_detail::pooled_names<Ts...>();
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+
+//************************
+//* TYPE IDS
+//************************
+
+// An RTTI-free stand-in for std::type_info / std::type_index. Equal types
+// have equal hashes, so unequal hashes settle it with one compare; equal
+// hashes are confirmed by the name, which is a pointer compare within one
+// binary and a string compare only across shared objects (or on a hash
+// collision). Works with -fno-rtti.
+//
+// Names are not unique for every type: closures (GCC spells them by the
+// enclosing function and signature only), local classes, unnamed types and
+// types in anonymous namespaces can share a name with distinct types. Their
+// handles carry the address of a per-type tag, and equal names are
+// confirmed by that instead. Such a handle only equals handles of the same
+// binary.
+
+namespace type_name_detail
+{
+    // Whether distinct types can be spelled like this name: it contains a
+    // closure, a local or unnamed class, or an anonymous namespace. (A name
+    // that merely looks like one of those only loses equality across shared
+    // objects.)
+    TYPE_NAME_CONSTEXPR bool shared_name(type_name_view name)
+    {
+        const type_name_view markers[] = { "<lambda", "(lambda", "<unnamed",
+                                           "{anonymous}", "(anonymous",
+                                           ")::" };
+        for (type_name_view marker : markers)
+        {
+            if (name.find(marker) != static_cast<std::size_t>(-1))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename T>
+    struct type_tag
+    {
+        static constexpr char id = 0;
+    };
+
+#ifndef TYPE_NAME_CONSTEXPR_NAMES
+    template<typename T>
+    constexpr char type_tag<T>::id;
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+} // namespace type_name_detail
+
+class type_handle
+{
+public:
+    // `tag` tells apart types whose names are not unique; see above.
+    TYPE_NAME_CONSTEXPR type_handle(std::uint64_t hash, type_name_view name,
+                                    const void* tag = nullptr)
+        : hash_(hash), name_(name), tag_(tag) {}
+
+    TYPE_NAME_CONSTEXPR std::uint64_t hash() const { return hash_; }
+    TYPE_NAME_CONSTEXPR type_name_view name() const { return name_; }
+
+    friend TYPE_NAME_CONSTEXPR bool operator==(type_handle lhs, type_handle rhs)
+    {
+        return lhs.hash_ == rhs.hash_
+            && (lhs.tag_ || rhs.tag_
+                    ? lhs.tag_ == rhs.tag_
+                    : lhs.name_.data() == rhs.name_.data()
+                          || lhs.name_ == rhs.name_);
+    }
+
+    friend TYPE_NAME_CONSTEXPR bool operator!=(type_handle lhs, type_handle rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    // An arbitrary but stable order, for ordered containers.
+    friend bool operator<(type_handle lhs, type_handle rhs)
+    {
+        if (lhs.hash_ != rhs.hash_) { return lhs.hash_ < rhs.hash_; }
+        const std::size_t size = lhs.name_.size() < rhs.name_.size()
+            ? lhs.name_.size() : rhs.name_.size();
+        const int order = std::memcmp(lhs.name_.data(), rhs.name_.data(), size);
+        if (order != 0) { return order < 0; }
+        if (lhs.name_.size() != rhs.name_.size())
+        {
+            return lhs.name_.size() < rhs.name_.size();
+        }
+        return std::less<const void*>()(lhs.tag_, rhs.tag_);
+    }
+
+private:
+    std::uint64_t hash_;
+    type_name_view name_;
+    const void* tag_;
+};
+
+template<typename T>
+TYPE_NAME_CONSTEXPR type_handle type_id()
+{
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+    constexpr bool shared = type_name_detail::shared_name(type_name_v<T>);
+#else
+    static const bool shared =
+        type_name_detail::shared_name(type_name_str<T>());
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+    return type_handle(type_hash<T>(), type_name_str<T>(),
+                       shared ? &type_name_detail::type_tag<T>::id : nullptr);
+}
+
+namespace std
+{
+    template<>
+    struct hash<type_handle>
+    {
+        std::size_t operator()(type_handle id) const
+        {
+            return static_cast<std::size_t>(id.hash());
+        }
+    };
+} // namespace std
+
+#ifdef TYPE_NAME_REGISTRY
+//************************
+//* REGISTRY
+//************************
+
+// With TYPE_NAME_ENABLE_REGISTRY, every type that is named also gets a
+// type_descriptor in the type_name_registry section, and the linker gathers
+// them into one array between __start_type_name_registry and
+// __stop_type_name_registry: no code runs at startup to build it.
+//
+// GCC puts template variables in sections of their own whatever their
+// section attribute says, so the descriptor is written by an assembler
+// directive in a function emitted once per type instead. The directive joins
+// the function's COMDAT group, so a type named in many translation units is
+// listed once. The name is an offset from the descriptor, which needs no
+// relocation at load time, so the section stays read-only.
+
+struct alignas(32) type_descriptor
+{
+    enum trait : std::uint32_t
+    {
+        fundamental = 1u << 0,
+        enumeration = 1u << 1,
+        class_type = 1u << 2,
+        union_type = 1u << 3,
+        pointer = 1u << 4,
+        member_pointer = 1u << 5,
+        reference = 1u << 6,
+        array = 1u << 7,
+        function = 1u << 8,
+        const_qualified = 1u << 9,
+        volatile_qualified = 1u << 10,
+        complete = 1u << 11,
+        trivially_copyable = 1u << 12,
+    };
+
+    // The name is found relative to the descriptor itself, so a copy would
+    // point at whatever follows it instead.
+    type_descriptor() = default;
+    type_descriptor(const type_descriptor&) = delete;
+    type_descriptor& operator=(const type_descriptor&) = delete;
+
+    std::int64_t name_offset;
+    std::uint64_t hash;
+    std::uint32_t name_size;
+    std::uint32_t size;  // 0 for incomplete types and functions
+    std::uint32_t align;
+    std::uint32_t traits;
+
+    type_name_view name() const
+    {
+        return type_name_view(
+            reinterpret_cast<const char*>(this) + name_offset, name_size);
+    }
+
+    bool has(trait t) const { return (traits & t) != 0; }
+};
+
+static_assert(sizeof(type_descriptor) == 32,
+              "descriptors are written by hand in registration<>::enlist");
+
+extern "C" TYPE_NAME_HIDDEN __attribute__((weak))
+const type_descriptor __start_type_name_registry[];
+extern "C" TYPE_NAME_HIDDEN __attribute__((weak))
+const type_descriptor __stop_type_name_registry[];
+
+namespace type_name_detail
+{
+    // sizeof is only valid on complete object types (and references).
+    template<typename T, typename = void>
+    struct is_complete : std::false_type {};
+
+    template<typename T>
+    struct is_complete<T, decltype(void(sizeof(T)))> : std::true_type {};
+
+    constexpr std::uint32_t trait_if(bool condition, type_descriptor::trait t)
+    {
+        return condition ? static_cast<std::uint32_t>(t) : 0u;
+    }
+
+    template<typename T, bool = is_complete<T>::value>
+    struct layout
+    {
+        static constexpr std::uint32_t size = 0;
+        static constexpr std::uint32_t align = 0;
+        static constexpr std::uint32_t traits = 0;
+    };
+
+    template<typename T>
+    struct layout<T, true>
+    {
+        static constexpr std::uint32_t size = sizeof(T);
+        static constexpr std::uint32_t align = alignof(T);
+        static constexpr std::uint32_t traits =
+            static_cast<std::uint32_t>(type_descriptor::complete)
+            | trait_if(std::is_trivially_copyable<T>::value,
+                       type_descriptor::trivially_copyable);
+    };
+
+    template<typename T>
+    constexpr std::uint32_t traits_of()
+    {
+        using d = type_descriptor;
+        return trait_if(std::is_fundamental<T>::value, d::fundamental)
+            | trait_if(std::is_enum<T>::value, d::enumeration)
+            | trait_if(std::is_class<T>::value, d::class_type)
+            | trait_if(std::is_union<T>::value, d::union_type)
+            | trait_if(std::is_pointer<T>::value, d::pointer)
+            | trait_if(std::is_member_pointer<T>::value, d::member_pointer)
+            | trait_if(std::is_reference<T>::value, d::reference)
+            | trait_if(std::is_array<T>::value, d::array)
+            | trait_if(std::is_function<T>::value, d::function)
+            | trait_if(std::is_const<T>::value, d::const_qualified)
+            | trait_if(std::is_volatile<T>::value, d::volatile_qualified)
+            | layout<T>::traits;
+    }
+
+    template<typename T>
+    struct registration<type_name<T> >
+    {
+        // 64-bit immediates do not survive -O0, so the hash goes in halves.
+        static constexpr std::uint64_t hash = type_hash_v<T>;
+        static constexpr std::uint32_t traits = traits_of<T>();
+
+        __attribute__((used)) static void enlist()
+        {
+            asm(".pushsection type_name_registry, \"a?\"\n\t"
+                ".balign 32\n\t"
+                ".quad %c0 - .\n\t"
+                ".long %c1, %c2\n\t"
+                ".long %c3, %c4, %c5, %c6\n\t"
+                ".popsection"
+                :
+                : "i"(rendered<T>::value.data),
+                  "i"(std::uint32_t(hash)), "i"(std::uint32_t(hash >> 32)),
+                  "i"(rendered<T>::size), "i"(layout<T>::size),
+                  "i"(layout<T>::align), "i"(traits));
+        }
+    };
+} // namespace type_name_detail
+
+// The descriptors of this binary (or shared object) as one contiguous
+// array, in link order.
+class type_registry_view
+{
+public:
+    type_registry_view(const type_descriptor* first,
+                       const type_descriptor* last)
+        : first_(first), last_(last) {}
+
+    const type_descriptor* begin() const { return first_; }
+    const type_descriptor* end() const { return last_; }
+    std::size_t size() const { return last_ - first_; }
+    bool empty() const { return first_ == last_; }
+    const type_descriptor& operator[](std::size_t i) const
+    {
+        return first_[i];
+    }
+
+private:
+    const type_descriptor* first_;
+    const type_descriptor* last_;
+};
+
+TYPE_NAME_HIDDEN inline type_registry_view type_registry()
+{
+    return type_registry_view(__start_type_name_registry,
+                              __stop_type_name_registry);
+}
+#endif // TYPE_NAME_REGISTRY
+
+//************************
+//* INTRINSIC NAMES
+//************************
+
+// Classes, unions, enums and class templates are named by the compiler
+// itself: the entity is spelled inside __PRETTY_FUNCTION__ of a function
+// template instantiated for it. The text around it is the same for every
+// argument, so it is measured once on a probe and cut off (in constant
+// expressions from C++17).
+
+namespace type_name_detail
+{
+    struct pretty_trim
+    {
+        std::size_t prefix;
+        std::size_t suffix;
+    };
+
+    TYPE_NAME_CONSTEXPR pretty_trim measure_pretty(type_name_view probe,
+                                                   type_name_view probe_name)
+    {
+        const std::size_t prefix = probe.find(probe_name);
+        return { prefix, probe.size() - prefix - probe_name.size() };
+    }
+
+    TYPE_NAME_CONSTEXPR type_name_view trim_pretty(type_name_view pretty,
+                                                   pretty_trim trim)
+    {
+        return pretty.substr(trim.prefix,
+                             pretty.size() - trim.prefix - trim.suffix);
+    }
+
+    template<typename T>
+    TYPE_NAME_CONSTEXPR type_name_view pretty_type()
+    {
+        return type_name_view(__PRETTY_FUNCTION__,
+                              sizeof(__PRETTY_FUNCTION__) - 1);
+    }
+
+    template<template<typename...> class C>
+    TYPE_NAME_CONSTEXPR type_name_view pretty_template()
+    {
+        return type_name_view(__PRETTY_FUNCTION__,
+                              sizeof(__PRETTY_FUNCTION__) - 1);
+    }
+
+    TYPE_NAME_CONSTEXPR pretty_trim type_trim()
+    {
+        return measure_pretty(pretty_type<double>(), "double");
+    }
+
+    TYPE_NAME_CONSTEXPR pretty_trim template_trim()
+    {
+        return measure_pretty(pretty_template<std::allocator>(),
+                              "std::allocator");
+    }
+
+    template<typename T>
+    TYPE_NAME_CONSTEXPR type_name_view intrinsic_name()
+    {
+        return trim_pretty(pretty_type<T>(), type_trim());
+    }
+
+    template<template<typename...> class C>
+    TYPE_NAME_CONSTEXPR type_name_view intrinsic_template_name()
+    {
+        return trim_pretty(pretty_template<C>(), template_trim());
+    }
+
+#ifdef __cpp_nontype_template_parameter_auto
+    // The same for template arguments that are values (enumerators,
+    // pointers...) and for templates taking values.
+    template<auto V>
+    constexpr type_name_view pretty_value()
+    {
+        return type_name_view(__PRETTY_FUNCTION__,
+                              sizeof(__PRETTY_FUNCTION__) - 1);
+    }
+
+    template<template<auto...> class C>
+    constexpr type_name_view pretty_value_template()
+    {
+        return type_name_view(__PRETTY_FUNCTION__,
+                              sizeof(__PRETTY_FUNCTION__) - 1);
+    }
+
+    template<template<typename, auto> class C>
+    constexpr type_name_view pretty_typed_value_template()
+    {
+        return type_name_view(__PRETTY_FUNCTION__,
+                              sizeof(__PRETTY_FUNCTION__) - 1);
+    }
+
+    template<auto V>
+    constexpr type_name_view intrinsic_value_name()
+    {
+        constexpr pretty_trim trim =
+            measure_pretty(pretty_value<1234567>(), "1234567");
+        return trim_pretty(pretty_value<V>(), trim);
+    }
+
+    template<template<auto...> class C>
+    constexpr type_name_view intrinsic_value_template_name()
+    {
+        constexpr pretty_trim trim =
+            measure_pretty(pretty_value_template<std::ratio>(), "std::ratio");
+        return trim_pretty(pretty_value_template<C>(), trim);
+    }
+
+    template<template<typename, auto> class C>
+    constexpr type_name_view intrinsic_value_template_name()
+    {
+        constexpr pretty_trim trim = measure_pretty(
+            pretty_typed_value_template<std::integral_constant>(),
+            "std::integral_constant");
+        return trim_pretty(pretty_typed_value_template<C>(), trim);
+    }
+#endif // __cpp_nontype_template_parameter_auto
+} // namespace type_name_detail
+
+//************************
+//* FUNDAMENTIAL TYPES
+//************************
+
+namespace type_name_detail
+{
+    // The name of no type, or of one that no specialization matches; see
+    // the end of this file.
+    template<typename... Ts>
+    struct named;
+} // namespace type_name_detail
+
+// The primary template, rather than a catch-all specialization, takes the
+// types that nothing else matches: any other type matches a single
+// specialization, and the compiler never has to order two of them.
+template<typename... Ts>
+struct type_name : type_name_detail::named<Ts...> {};
+
+#define FUNDAMENTIAL_TYPE_NAME(type)                                        \
+template<>                                                                  \
+struct type_name<type>                                                      \
+{                                                                           \
+    template<typename Sink>                                                 \
+    static TYPE_NAME_CONSTEXPR void write(Sink& s)                          \
+    {                                                                       \
+        s.append_literal(#type);                                            \
+    }                                                                       \
+}
+
+FUNDAMENTIAL_TYPE_NAME(void);
+#if __cplusplus >= 201402L // C++14
+FUNDAMENTIAL_TYPE_NAME(std::nullptr_t);
+#endif //__cplusplus >= 201402L
+FUNDAMENTIAL_TYPE_NAME(bool);
+FUNDAMENTIAL_TYPE_NAME(char);
+FUNDAMENTIAL_TYPE_NAME(signed char);
+FUNDAMENTIAL_TYPE_NAME(unsigned char);
+FUNDAMENTIAL_TYPE_NAME(short int);
+FUNDAMENTIAL_TYPE_NAME(int);
+FUNDAMENTIAL_TYPE_NAME(long int);
+FUNDAMENTIAL_TYPE_NAME(long long int);
+FUNDAMENTIAL_TYPE_NAME(unsigned short int);
+FUNDAMENTIAL_TYPE_NAME(unsigned int);
+FUNDAMENTIAL_TYPE_NAME(unsigned long int);
+FUNDAMENTIAL_TYPE_NAME(unsigned long long int);
+FUNDAMENTIAL_TYPE_NAME(float);
+FUNDAMENTIAL_TYPE_NAME(double);
+FUNDAMENTIAL_TYPE_NAME(long double);
+FUNDAMENTIAL_TYPE_NAME(wchar_t);
+FUNDAMENTIAL_TYPE_NAME(char16_t);
+FUNDAMENTIAL_TYPE_NAME(char32_t);
+#ifdef __cpp_char8_t
+FUNDAMENTIAL_TYPE_NAME(char8_t);
+#endif // __cpp_char8_t
+#ifdef __SIZEOF_INT128__
+FUNDAMENTIAL_TYPE_NAME(__int128);
+FUNDAMENTIAL_TYPE_NAME(unsigned __int128);
+#endif // __SIZEOF_INT128__
+#ifdef __FLT16_MANT_DIG__
+FUNDAMENTIAL_TYPE_NAME(_Float16);
+#endif // __FLT16_MANT_DIG__
+#ifdef __BFLT16_MANT_DIG__
+FUNDAMENTIAL_TYPE_NAME(__bf16);
+#endif // __BFLT16_MANT_DIG__
+
+// VECTORS
+// GCC and Clang vector extensions (__m256 is a float vector of 32 bytes)
+// are named by lane type and count: `float x8`. The lane count cannot be
+// deduced from a vector type, so every lane type and width is listed.
+#ifdef __GNUC__
+namespace type_name_detail
+{
+    template<typename Lane, std::size_t Bytes>
+    struct vector_type_name
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)
+        {
+            s.append(type_name_str<Lane>()).append_literal(" x");
+            s.append_unsigned(Bytes / sizeof(Lane));
+        }
+    };
+} // namespace type_name_detail
+
+#define VECTOR_TYPE_NAME(lane, bytes)                                       \
+template<>                                                                  \
+struct type_name<lane __attribute__((vector_size(bytes)))>                  \
+    : type_name_detail::vector_type_name<lane, bytes> {}
+
+#define VECTOR_TYPE_NAMES(lane)                                             \
+    VECTOR_TYPE_NAME(lane, 8);                                              \
+    VECTOR_TYPE_NAME(lane, 16);                                             \
+    VECTOR_TYPE_NAME(lane, 32);                                             \
+    VECTOR_TYPE_NAME(lane, 64)
+
+VECTOR_TYPE_NAMES(char);
+VECTOR_TYPE_NAMES(signed char);
+VECTOR_TYPE_NAMES(unsigned char);
+VECTOR_TYPE_NAMES(short int);
+VECTOR_TYPE_NAMES(unsigned short int);
+VECTOR_TYPE_NAMES(int);
+VECTOR_TYPE_NAMES(unsigned int);
+VECTOR_TYPE_NAMES(long int);
+VECTOR_TYPE_NAMES(unsigned long int);
+VECTOR_TYPE_NAMES(long long int);
+VECTOR_TYPE_NAMES(unsigned long long int);
+VECTOR_TYPE_NAMES(float);
+VECTOR_TYPE_NAMES(double);
+#ifdef __FLT16_MANT_DIG__
+VECTOR_TYPE_NAMES(_Float16);
+#endif // __FLT16_MANT_DIG__
+#endif // __GNUC__
+
+//************************
+//* COMPOUND TYPES
+//************************
+
+// Compound types are rendered as a declarator: a left and a right part
+// around the spot where a declared name would go. Array bounds go to the
+// right. Pointers, references and member pointers to functions and arrays
+// are written between the two parts, inside parentheses, so `int(*)[4]`
+// and `int(*)(int)` come out in declaration order.
+//
+// The walk visits each declarator level once, outside in, writing both
+// parts in a single pass; what sits at the core of it (a class, a
+// fundamental type, a parameter list) is appended from its own rendered
+// string rather than walked again.
+
+namespace type_name_detail
+{
+    template<typename T, typename = void>
+    struct declarator
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_left(Sink& s)
+        {
+            s.append(type_name_str<T>());
+        }
+
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_right(Sink&)
+        {
+        }
+    };
+
+    // Whether a pointer, reference or member pointer to T needs parentheses.
+    template<typename T>
+    struct nests
+        : std::integral_constant<bool, std::is_function<T>::value
+                                       || std::is_array<T>::value> {};
+
+    template<typename T>
+    struct declared
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)
+        {
+            declarator<T>::write_left(s);
+            declarator<T>::write_right(s);
+        }
+    };
+} // namespace type_name_detail
+
+#define COMPOUND_TYPE_NAME_NESTED(delimiter, type_modifier, nesting)       \
+namespace type_name_detail                                                  \
+{                                                                           \
+    template<typename T>                                                    \
+    struct declarator<T type_modifier>                                      \
+    {                                                                       \
+        static constexpr bool nested = nesting;                             \
+                                                                            \
+        template<typename Sink>                                             \
+        static TYPE_NAME_CONSTEXPR void write_left(Sink& s)                 \
+        {                                                                   \
+            declarator<T>::write_left(s);                                   \
+            if (nested) { s.append_literal("("); }                          \
+            s.append_literal(delimiter).append_literal(#type_modifier);     \
+        }                                                                   \
+                                                                            \
+        template<typename Sink>                                             \
+        static TYPE_NAME_CONSTEXPR void write_right(Sink& s)                \
+        {                                                                   \
+            if (nested) { s.append_literal(")"); }                          \
+            declarator<T>::write_right(s);                                  \
+        }                                                                   \
+    };                                                                      \
+}                                                                           \
+                                                                            \
+template<typename T>                                                        \
+struct type_name<T type_modifier>                                           \
+    : type_name_detail::declared<T type_modifier> {}
+
+#define COMPOUND_TYPE_NAME(type_modifier)                                   \
+    COMPOUND_TYPE_NAME_NESTED("", type_modifier, nests<T>::value)
+
+#define COMPOUND_TYPE_NAME_DELIMITED(delimiter, type_modifier)              \
+    COMPOUND_TYPE_NAME_NESTED(delimiter, type_modifier, false)
+
+// ARRAYS
+namespace type_name_detail
+{
+    template<typename T, bool Bounded, std::size_t N>
+    struct array_declarator
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_left(Sink& s)
+        {
+            declarator<T>::write_left(s);
+        }
+
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_right(Sink& s)
+        {
+            s.append_literal("[");
+            if (Bounded) { s.append_unsigned(N); }
+            s.append_literal("]");
+            declarator<T>::write_right(s);
+        }
+    };
+} // namespace type_name_detail
+
+// A cv-qualified array is an array of cv-qualified elements, but it matches
+// both T[N] and T const; these more specialized forms settle it.
+#define ARRAY_TYPE_NAME(cv)                                                 \
+namespace type_name_detail                                                  \
+{                                                                           \
+    template<typename T>                                                    \
+    struct declarator<T cv[]> : array_declarator<T cv, false, 0> {};        \
+                                                                            \
+    template<typename T, std::size_t N>                                     \
+    struct declarator<T cv[N]> : array_declarator<T cv, true, N> {};        \
+}                                                                           \
+                                                                            \
+template<typename T>                                                        \
+struct type_name<T cv[]> : type_name_detail::declared<T cv[]> {};           \
+                                                                            \
+template<typename T, std::size_t N>                                         \
+struct type_name<T cv[N]> : type_name_detail::declared<T cv[N]> {}
+
+ARRAY_TYPE_NAME();
+ARRAY_TYPE_NAME(const);
+ARRAY_TYPE_NAME(volatile);
+ARRAY_TYPE_NAME(const volatile);
+
+// POINTER, REF and CV
+COMPOUND_TYPE_NAME(*);
+COMPOUND_TYPE_NAME(&);
+COMPOUND_TYPE_NAME(&&);
+COMPOUND_TYPE_NAME_DELIMITED(" ", const);
+COMPOUND_TYPE_NAME_DELIMITED(" ", volatile);
+COMPOUND_TYPE_NAME_DELIMITED(" ", const volatile);
+
+// ARGUMENTS
+// Expanded in one braced list rather than by peeling one argument per level,
+// so a pack of any length costs one instantiation per distinct argument type
+// and no nesting. (A comma fold would be flat too, but GCC evaluates long
+// folds in quadratic time.) Two or more: a single type is not a list.
+template<typename Arg, typename Next, typename... Args>
+struct type_name<Arg, Next, Args...>
+{
+    template<typename Sink>
+    static TYPE_NAME_CONSTEXPR void write(Sink& s)
+    {
+        s.append(type_name_str<Arg>()).append_literal(", ");
+        s.append(type_name_str<Next>());
+        bool rest[] = {
+            true,
+            (s.append_literal(", ").append(type_name_str<Args>()), true)...
+        };
+        (void)rest;
+    }
+};
+
+// FUNCTION
+
+// function_traits splits a function type into its return type, parameters,
+// trailing C-style ellipsis, cv/ref qualifiers and noexcept. Plain and
+// variadic signatures times the twelve qualifier combinations are the only
+// specializations (noexcept is deduced); pointers, references and member
+// pointers to functions reach them through the declarators above.
+
+namespace type_name_detail
+{
+    template<typename R, typename Args, std::size_t Arity, bool Variadic,
+             bool Noexcept>
+    struct function_signature
+    {
+        using result = R;
+        using arguments = Args;
+        static constexpr std::size_t arity = Arity;
+        static constexpr bool variadic = Variadic;
+        static constexpr bool is_noexcept = Noexcept;
+    };
+
+    template<typename F>
+    struct function_traits;
+} // namespace type_name_detail
+
+// noexcept is part of the function type from C++17 only.
+#ifdef __cpp_noexcept_function_type
+#define TYPE_NAME_NOEXCEPT_PARAM , bool NE
+#define TYPE_NAME_NOEXCEPT_SPEC noexcept(NE)
+#define TYPE_NAME_NOEXCEPT_VALUE NE
+#else
+#define TYPE_NAME_NOEXCEPT_PARAM
+#define TYPE_NAME_NOEXCEPT_SPEC
+#define TYPE_NAME_NOEXCEPT_VALUE false
+#endif // __cpp_noexcept_function_type
+
+#define FUNCTION_TRAITS(cvr)                                                \
+namespace type_name_detail                                                  \
+{                                                                           \
+    template<typename R, typename... Args TYPE_NAME_NOEXCEPT_PARAM>         \
+    struct function_traits<R(Args...) cvr TYPE_NAME_NOEXCEPT_SPEC>          \
+        : function_signature<R, type_name<Args...>, sizeof...(Args),        \
+                             false, TYPE_NAME_NOEXCEPT_VALUE>               \
+    {                                                                       \
+        static TYPE_NAME_CONSTEXPR type_name_view qualifiers()              \
+        {                                                                   \
+            return type_name_view(" " #cvr,                                 \
+                                  sizeof(#cvr) > 1 ? sizeof(#cvr) : 0);     \
+        }                                                                   \
+    };                                                                      \
+                                                                            \
+    template<typename R, typename... Args TYPE_NAME_NOEXCEPT_PARAM>         \
+    struct function_traits<R(Args..., ...) cvr TYPE_NAME_NOEXCEPT_SPEC>     \
+        : function_signature<R, type_name<Args...>, sizeof...(Args),        \
+                             true, TYPE_NAME_NOEXCEPT_VALUE>                \
+    {                                                                       \
+        static TYPE_NAME_CONSTEXPR type_name_view qualifiers()              \
+        {                                                                   \
+            return type_name_view(" " #cvr,                                 \
+                                  sizeof(#cvr) > 1 ? sizeof(#cvr) : 0);     \
+        }                                                                   \
+    };                                                                      \
+}
+
+FUNCTION_TRAITS()
+FUNCTION_TRAITS(const)
+FUNCTION_TRAITS(volatile)
+FUNCTION_TRAITS(const volatile)
+FUNCTION_TRAITS(&)
+FUNCTION_TRAITS(const &)
+FUNCTION_TRAITS(volatile &)
+FUNCTION_TRAITS(const volatile &)
+FUNCTION_TRAITS(&&)
+FUNCTION_TRAITS(const &&)
+FUNCTION_TRAITS(volatile &&)
+FUNCTION_TRAITS(const volatile &&)
+
+namespace type_name_detail
+{
+    template<typename F>
+    struct declarator<
+        F, typename std::enable_if<std::is_function<F>::value>::type>
+    {
+        using traits = function_traits<F>;
+
+        // The parameter list goes inside the declarator of the result, so a
+        // function returning a function pointer is void(*(int))(char).
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_left(Sink& s)
+        {
+            declarator<typename traits::result>::write_left(s);
+        }
+
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_right(Sink& s)
+        {
+            s.append_literal("(");
+            s.append(name_string<typename traits::arguments>());
+            if (!traits::variadic) { s.append_literal(")"); }
+            else if (traits::arity) { s.append_literal(", ...)"); }
+            else { s.append_literal("...)"); }
+            s.append(traits::qualifiers());
+            if (traits::is_noexcept) { s.append_literal(" noexcept"); }
+            declarator<typename traits::result>::write_right(s);
+        }
+    };
+} // namespace type_name_detail
+
+
+/* SFINAE attempt -- not working
+#if __cplusplus < 201402L // C++11 or before
+namespace std
+{
+    template< bool B, class T = void >
+    using enable_if_t = typename enable_if<B, T>::type;
+}
+#endif //__cplusplus < 201402L
+template <typename F>
+using enable_if_function = std::enable_if_t<std::is_function<F>::value>;
+template <typename F, typename = enable_if_function<F> >
+struct type_name<F const> : type_name<F> {};
+*/
+
+// template class
+template <template <typename...> class C, typename... Args>
+struct type_name< C<Args...> >
+{
+    template<typename Sink>
+    static TYPE_NAME_CONSTEXPR void write(Sink& s)
+    {
+        s.append(type_name_detail::intrinsic_template_name<C>());
+        s.append_literal("<").append(type_name_str<Args...>());
+        s.append_literal(">");
+    }
+};
+
+//************************
+//* NON-TYPE ARGUMENTS
+//************************
+
+namespace type_name_detail
+{
+    // Durations name their period: std::chrono::duration<long int, ms>.
+    template<std::intmax_t Num, std::intmax_t Den>
+    struct ratio_unit
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)
+        {
+            s.append(type_name_str<std::ratio<Num, Den> >());
+        }
+    };
+
+#define RATIO_UNIT(num, den, unit)                                          \
+    template<>                                                              \
+    struct ratio_unit<num, den>                                             \
+    {                                                                       \
+        template<typename Sink>                                             \
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)                      \
+        {                                                                   \
+            s.append_literal(unit);                                         \
+        }                                                                   \
+    };
+
+    RATIO_UNIT(1, 1000000000, "ns")
+    RATIO_UNIT(1, 1000000, "us")
+    RATIO_UNIT(1, 1000, "ms")
+    RATIO_UNIT(1, 1, "s")
+    RATIO_UNIT(60, 1, "min")
+    RATIO_UNIT(3600, 1, "h")
+    RATIO_UNIT(86400, 1, "d")
+#undef RATIO_UNIT
+} // namespace type_name_detail
+
+template <typename Rep, typename Period>
+struct type_name< std::chrono::duration<Rep, Period> >
+{
+    template<typename Sink>
+    static TYPE_NAME_CONSTEXPR void write(Sink& s)
+    {
+        s.append_literal("std::chrono::duration<").append(type_name_str<Rep>());
+        s.append_literal(", ");
+        type_name_detail::ratio_unit<Period::num, Period::den>::write(s);
+        s.append_literal(">");
+    }
+};
+
+#ifdef __cpp_nontype_template_parameter_auto
+namespace type_name_detail
+{
+    template<typename T>
+    struct is_character : std::false_type {};
+
+    template<> struct is_character<char> : std::true_type {};
+    template<> struct is_character<wchar_t> : std::true_type {};
+    template<> struct is_character<char16_t> : std::true_type {};
+    template<> struct is_character<char32_t> : std::true_type {};
+#ifdef __cpp_char8_t
+    template<> struct is_character<char8_t> : std::true_type {};
+#endif // __cpp_char8_t
+
+    // Integers are spelled here, the same on every compiler; anything else
+    // (enumerators, characters, pointers) as the compiler spells it.
+    template<auto V>
+    struct value
+    {
+        template<typename Sink>
+        static constexpr void write(Sink& s)
+        {
+            using T = decltype(V);
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                s.append(V ? "true" : "false");
+            }
+            else if constexpr (std::is_integral_v<T> && !is_character<T>{})
+            {
+                if constexpr (std::is_signed_v<T>) { s.append_signed(V); }
+                else { s.append_unsigned(V); }
+            }
+            else
+            {
+                s.append(intrinsic_value_name<V>());
+            }
+        }
+    };
+
+    template<auto... Vs>
+    struct values
+    {
+        template<typename Sink>
+        static constexpr void write(Sink&)
+        {
+        }
+    };
+
+    template<auto V, auto... Vs>
+    struct values<V, Vs...>
+    {
+        template<typename Sink>
+        static constexpr void write(Sink& s)
+        {
+            value<V>::write(s);
+            bool rest[] = {
+                true, (s.append_literal(", "), value<Vs>::write(s), true)...
+            };
+            (void)rest;
+        }
+    };
+} // namespace type_name_detail
+
+// template class of values: std::bitset<64>, std::ratio<1, 1000>
+template <template <auto...> class C, auto... Vs>
+struct type_name< C<Vs...> >
+{
+    template<typename Sink>
+    static constexpr void write(Sink& s)
+    {
+        s.append(type_name_detail::intrinsic_value_template_name<C>());
+        s.append_literal("<");
+        type_name_detail::values<Vs...>::write(s);
+        s.append_literal(">");
+    }
+};
+
+// template class of a type and a value: std::array<int, 4>
+template <template <typename, auto> class C, typename T, auto V>
+struct type_name< C<T, V> >
+{
+    template<typename Sink>
+    static constexpr void write(Sink& s)
+    {
+        s.append(type_name_detail::intrinsic_value_template_name<C>());
+        s.append_literal("<").append(type_name_str<T>()).append_literal(", ");
+        type_name_detail::value<V>::write(s);
+        s.append_literal(">");
+    }
+};
+
+template <typename T, T... Vs>
+struct type_name< std::integer_sequence<T, Vs...> >
+{
+    template<typename Sink>
+    static constexpr void write(Sink& s)
+    {
+        s.append_literal("std::integer_sequence<").append(type_name_str<T>());
+        if (sizeof...(Vs) != 0) { s.append_literal(", "); }
+        type_name_detail::values<Vs...>::write(s);
+        s.append_literal(">");
+    }
+};
+#endif // __cpp_nontype_template_parameter_auto
+
+// class, struct, union, enum and function: what no specialization matches
+namespace type_name_detail
+{
+    template<typename C>
+    struct intrinsic
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)
+        {
+            s.append(intrinsic_name<C>());
+        }
+    };
+
+    template<>
+    struct named<>
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink&)
+        {
+        }
+    };
+
+    template<typename C>
+    struct named<C>
+        : std::conditional<std::is_function<C>::value, declared<C>,
+                           intrinsic<C> >::type {};
+} // namespace type_name_detail
+
+// pointer to member
+namespace type_name_detail
+{
+    template<typename T, typename C>
+    struct declarator<T C::*>
+    {
+        static constexpr bool nested = nests<T>::value;
+
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_left(Sink& s)
+        {
+            declarator<T>::write_left(s);
+            s.append_literal(nested ? "(" : " ").append(type_name_str<C>());
+            s.append_literal("::*");
+        }
+
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write_right(Sink& s)
+        {
+            if (nested) { s.append_literal(")"); }
+            declarator<T>::write_right(s);
+        }
+    };
+} // namespace type_name_detail
+
+template <typename T, typename C>
+struct type_name<T C::*> : type_name_detail::declared<T C::*> {};
+
+
+//************************
+//* CALL SIGNATURES
+//************************
+
+// A function object's name followed by the signature of its call operator:
+// `fn : int(int)`, `main()::<lambda()> : void() const`. This is a separate
+// name, so type_name<C> (and every name C appears in, and its hash) stays
+// the same whether or not C has an operator(). Types with no call operator,
+// or with a template or overloaded one, whose address cannot be taken, get
+// their name alone.
+
+namespace type_name_detail
+{
+    template<typename C, typename = void>
+    struct call_signature
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink&)
+        {
+        }
+    };
+
+    template<typename M>
+    struct member_function;
+
+    template<typename F, typename C>
+    struct member_function<F C::*>
+    {
+        using type = F;
+    };
+
+    template<typename C>
+    struct call_signature<C, decltype(void(&C::operator()))>
+    {
+        using signature =
+            typename member_function<decltype(&C::operator())>::type;
+
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)
+        {
+            s.append_literal(" : ").append(type_name_str<signature>());
+        }
+    };
+
+    template<typename T>
+    struct signed_name
+    {
+        template<typename Sink>
+        static TYPE_NAME_CONSTEXPR void write(Sink& s)
+        {
+            s.append(type_name_str<T>());
+            call_signature<T>::write(s);
+        }
+    };
+} // namespace type_name_detail
+
+template<typename T>
+TYPE_NAME_CONSTEXPR type_name_view type_signature_str()
+{
+    return type_name_detail::name_string<type_name_detail::signed_name<T> >();
+}
+
+#ifdef TYPE_NAME_CONSTEXPR_NAMES
+template<typename T>
+inline constexpr type_name_view type_signature_v = type_signature_str<T>();
+#endif // TYPE_NAME_CONSTEXPR_NAMES
+
+#endif // TYPE_NAME_H
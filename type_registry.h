@@ -0,0 +1,363 @@
+#ifndef TYPE_REGISTRY_H
+#define TYPE_REGISTRY_H
+
+#include "type_name.h"
+
+#ifdef TYPE_NAME_REGISTRY
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+//************************
+//* PERFECT HASH
+//************************
+
+// A read-only index from a type's hash, or its name, to its descriptor, in
+// O(1) with no string compare on the hash path. Built once (e.g. at startup
+// from type_registry()) as a minimal perfect hash by hash-and-displace:
+// the hashes are split into buckets of about four, and, largest bucket
+// first, each bucket gets the first seed that sends all its hashes to free
+// slots. Buckets of one take a free slot directly. A lookup is one seed
+// load, one slot load and one compare.
+//
+// The table also numbers the types densely, in [0, size()), by hash and
+// then name, so per-type counters or handlers can live in flat arrays
+// indexed by id. The numbering only depends on which types are listed, so
+// the same binary always gets the same ids.
+//
+// The registry lists each type once; should two types share a 64-bit hash,
+// the one with the smaller name is kept. Types whose names are not unique
+// (closures, local classes, anything in an anonymous namespace; see
+// type_handle) are the exception: each keeps its own entry and id, next to
+// the others of that name. A lookup by hash or name finds the first of
+// them; id(descriptor) and find_stored(name) tell them apart by address.
+
+namespace type_name_detail
+{
+    inline std::uint64_t displace(std::uint64_t hash, std::uint32_t seed)
+    {
+        // splitmix64's finalizer over the hash offset by the seed.
+        std::uint64_t x = hash + seed * 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+} // namespace type_name_detail
+
+class type_table
+{
+public:
+    explicit type_table(type_registry_view registry)
+    {
+        std::vector<const type_descriptor*> types;
+        types.reserve(registry.size());
+        for (const type_descriptor& d : registry) { types.push_back(&d); }
+        std::sort(types.begin(), types.end(),
+                  [](const type_descriptor* a, const type_descriptor* b) {
+                      if (a->hash != b->hash) { return a->hash < b->hash; }
+                      if (a->name() != b->name())
+                      {
+                          return a->name() < b->name();
+                      }
+                      return a < b;  // link order, for shared names
+                  });
+        types.erase(std::unique(types.begin(), types.end(),
+                                [](const type_descriptor* a,
+                                   const type_descriptor* b) {
+                                    return a->hash == b->hash
+                                        && !(a->name() == b->name()
+                                             && type_name_detail::shared_name(
+                                                    a->name()));
+                                }),
+                    types.end());
+        build(types);
+        types_ = std::move(types);
+    }
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    std::size_t size() const { return types_.size(); }
+
+    const type_descriptor* find(std::uint64_t hash) const
+    {
+        const std::size_t slot = slot_of(hash);
+        return slot != npos ? slots_[slot] : nullptr;
+    }
+
+    const type_descriptor* find(type_name_view name) const
+    {
+        const type_descriptor* d = find(type_name_detail::fnv1a(name));
+        return d && d->name() == name ? d : nullptr;
+    }
+
+    // The entry whose name is stored at name.data(), i.e. the one of that
+    // very type even when other types share its name.
+    const type_descriptor* find_stored(type_name_view name) const
+    {
+        const std::size_t first = id(type_name_detail::fnv1a(name));
+        for (std::size_t i = first; i < size() && first != npos; ++i)
+        {
+            const type_descriptor* d = types_[i];
+            if (d->hash != types_[first]->hash) { break; }
+            if (d->name().data() == name.data()
+                && d->name().size() == name.size())
+            {
+                return d;
+            }
+        }
+        return nullptr;
+    }
+
+    // The dense id of the (first) type with this hash, or npos.
+    std::size_t id(std::uint64_t hash) const
+    {
+        const std::size_t slot = slot_of(hash);
+        return slot != npos ? ids_[slot] : npos;
+    }
+
+    // The dense id of this entry, or npos if it is not in the table.
+    std::size_t id(const type_descriptor& d) const
+    {
+        const std::size_t first = id(d.hash);
+        for (std::size_t i = first; i < size() && first != npos; ++i)
+        {
+            if (types_[i] == &d) { return i; }
+            if (types_[i]->hash != d.hash) { break; }
+        }
+        return npos;
+    }
+
+    const type_descriptor& operator[](std::size_t id) const
+    {
+        return *types_[id];
+    }
+
+private:
+    std::size_t slot_of(std::uint64_t hash) const
+    {
+        if (slots_.empty()) { return npos; }
+        const std::int64_t seed = seeds_[hash % seeds_.size()];
+        const std::size_t slot = seed < 0
+            ? static_cast<std::size_t>(-seed - 1)
+            : type_name_detail::displace(hash, static_cast<std::uint32_t>(seed))
+                  % slots_.size();
+        return slots_[slot]->hash == hash ? slot : npos;
+    }
+
+    void build(const std::vector<const type_descriptor*>& types)
+    {
+        // Only the first of the types sharing a hash gets a slot.
+        std::vector<std::uint32_t> keys;
+        for (std::size_t id = 0; id < types.size(); ++id)
+        {
+            if (id != 0 && types[id]->hash == types[id - 1]->hash) { continue; }
+            keys.push_back(static_cast<std::uint32_t>(id));
+        }
+        const std::size_t n = keys.size();
+        if (n == 0) { return; }
+        seeds_.assign(n / 4 + 1, 0);
+        slots_.assign(n, nullptr);
+        ids_.assign(n, 0);
+
+        std::vector<std::vector<std::uint32_t> > buckets(seeds_.size());
+        for (std::uint32_t id : keys)
+        {
+            buckets[types[id]->hash % buckets.size()].push_back(id);
+        }
+        std::vector<std::size_t> order(buckets.size());
+        for (std::size_t b = 0; b < order.size(); ++b) { order[b] = b; }
+        std::stable_sort(order.begin(), order.end(),
+                         [&](std::size_t a, std::size_t b) {
+                             return buckets[a].size() > buckets[b].size();
+                         });
+
+        std::vector<std::size_t> taken;
+        std::size_t next_free = 0;
+        for (std::size_t b : order)
+        {
+            const std::vector<std::uint32_t>& bucket = buckets[b];
+            if (bucket.empty()) { break; }
+            if (bucket.size() == 1)
+            {
+                while (slots_[next_free]) { ++next_free; }
+                slots_[next_free] = types[bucket[0]];
+                ids_[next_free] = bucket[0];
+                seeds_[b] = -static_cast<std::int64_t>(next_free) - 1;
+                continue;
+            }
+            for (std::uint32_t seed = 1;; ++seed)
+            {
+                taken.clear();
+                for (std::uint32_t id : bucket)
+                {
+                    const std::size_t slot =
+                        type_name_detail::displace(types[id]->hash, seed) % n;
+                    if (slots_[slot]
+                        || std::find(taken.begin(), taken.end(), slot)
+                               != taken.end())
+                    {
+                        break;
+                    }
+                    taken.push_back(slot);
+                }
+                if (taken.size() != bucket.size()) { continue; }
+                for (std::size_t i = 0; i < taken.size(); ++i)
+                {
+                    slots_[taken[i]] = types[bucket[i]];
+                    ids_[taken[i]] = bucket[i];
+                }
+                seeds_[b] = seed;
+                break;
+            }
+        }
+    }
+
+    // Per bucket: a seed for displace(), or -(slot + 1) for a bucket of one.
+    std::vector<std::int64_t> seeds_;
+    std::vector<const type_descriptor*> slots_;
+    std::vector<std::uint32_t> ids_;
+    std::vector<const type_descriptor*> types_;  // by id
+};
+
+// The table of this binary (or shared object), built on first use.
+TYPE_NAME_HIDDEN inline const type_table& registered_types()
+{
+    static const type_table table(type_registry());
+    return table;
+}
+
+// The dense id of T in registered_types(), looked up once per type. T's
+// own entry is found by where its name is stored, so types that share a
+// name get ids of their own.
+template<typename T>
+TYPE_NAME_HIDDEN std::size_t dense_type_id()
+{
+    static const std::size_t id = [] {
+        const type_table& table = registered_types();
+        const type_descriptor* d = table.find_stored(type_name_str<T>());
+        return d ? table.id(*d) : type_table::npos;
+    }();
+    return id;
+}
+
+//************************
+//* CONCURRENT REGISTRY
+//************************
+
+// A catalog shared by a host and the shared objects it loads: each one
+// inserts its own type_registry() (the section symbols are hidden, so that
+// is the shared object's own table) and everyone looks types up by hash.
+//
+// Open addressing with linear probing over atomic descriptor pointers. An
+// insert claims an empty slot with a compare-and-swap and never waits for
+// another thread; a lookup is at most one pass over the slots, so it is
+// wait-free. A type that is already there, from any shared object, is not
+// added again: the entry inserted first stands for it. Types whose names are
+// not unique (see type_handle) are the exception, as two of them with the
+// same name may well be different types: each descriptor of such a name is
+// an entry of its own, and find_stored() tells them apart. The capacity is
+// fixed (rounded up to a power of two), and entries are never removed, so a
+// shared object that inserted types must stay loaded.
+
+class concurrent_type_registry
+{
+public:
+    explicit concurrent_type_registry(std::size_t capacity = 1 << 16)
+        : mask_(slots_for(capacity) - 1),
+          slots_(new std::atomic<const type_descriptor*>[mask_ + 1]())
+    {
+    }
+
+    // The entry for d's type: d itself, or the one inserted before it.
+    // nullptr when the registry is full.
+    const type_descriptor* insert(const type_descriptor& d)
+    {
+        const bool shared = type_name_detail::shared_name(d.name());
+        for (std::size_t i = 0, slot = d.hash & mask_; i <= mask_;
+             ++i, slot = (slot + 1) & mask_)
+        {
+            const type_descriptor* entry =
+                slots_[slot].load(std::memory_order_acquire);
+            if (!entry
+                && slots_[slot].compare_exchange_strong(
+                       entry, &d, std::memory_order_acq_rel,
+                       std::memory_order_acquire))
+            {
+                size_.fetch_add(1, std::memory_order_relaxed);
+                return &d;
+            }
+            if (entry->hash == d.hash && (!shared || entry == &d))
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    // Inserts every type of a registry; false if some did not fit.
+    bool insert(type_registry_view types)
+    {
+        bool fit = true;
+        for (const type_descriptor& d : types) { fit &= insert(d) != nullptr; }
+        return fit;
+    }
+
+    const type_descriptor* find(std::uint64_t hash) const
+    {
+        for (std::size_t i = 0, slot = hash & mask_; i <= mask_;
+             ++i, slot = (slot + 1) & mask_)
+        {
+            const type_descriptor* entry =
+                slots_[slot].load(std::memory_order_acquire);
+            if (!entry || entry->hash == hash) { return entry; }
+        }
+        return nullptr;
+    }
+
+    const type_descriptor* find(type_name_view name) const
+    {
+        const type_descriptor* d = find(type_name_detail::fnv1a(name));
+        return d && d->name() == name ? d : nullptr;
+    }
+
+    // The entry whose name is stored at name.data(), i.e. the one inserted
+    // from the shared object that name comes from.
+    const type_descriptor* find_stored(type_name_view name) const
+    {
+        const std::uint64_t hash = type_name_detail::fnv1a(name);
+        for (std::size_t i = 0, slot = hash & mask_; i <= mask_;
+             ++i, slot = (slot + 1) & mask_)
+        {
+            const type_descriptor* entry =
+                slots_[slot].load(std::memory_order_acquire);
+            if (!entry) { return nullptr; }
+            if (entry->hash == hash && entry->name().data() == name.data()
+                && entry->name().size() == name.size())
+            {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+private:
+    static std::size_t slots_for(std::size_t capacity)
+    {
+        std::size_t slots = 1;
+        while (slots < capacity) { slots *= 2; }
+        return slots;
+    }
+
+    const std::size_t mask_;
+    const std::unique_ptr<std::atomic<const type_descriptor*>[]> slots_;
+    std::atomic<std::size_t> size_{0};
+};
+#endif // TYPE_NAME_REGISTRY
+
+#endif // TYPE_REGISTRY_H